@@ -49,6 +49,8 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 - removed undocumented registers and commands
 - merged FT80x and FT81x definitions as FT81x is baseline now
 - removed the history from before 4.0
+- moved EVE_OPT_FORMAT to the widget options for all generations, the _var functions handle it on the host for FT81x
+- added DL_NOP as the NOP() macro stays commented out
 
 */
 
@@ -84,6 +86,7 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define DL_END        0x21000000
 #define DL_BEGIN      0x1F000000 /* requires OR'd arguments */
 #define DL_DISPLAY    0x00000000
+#define DL_NOP        0x2D000000
 
 
 #define CLR_COL       0x4
@@ -218,6 +221,7 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define EVE_OPT_NOHANDS          49152
 #define EVE_OPT_RIGHTX           2048
 #define EVE_OPT_SIGNED           256
+#define EVE_OPT_FORMAT           4096UL /* BT81x only, for FT81x the _var functions convert the string on the host */
 
 #define EVE_OPT_MEDIAFIFO        16UL
 #define EVE_OPT_FULLSCREEN       8UL
@@ -629,7 +633,6 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define EVE_RAM_FLASH_POSTBLOB  0x801000UL
 
 #define EVE_OPT_FLASH  64UL
-#define EVE_OPT_FORMAT 4096UL
 #define EVE_OPT_FILL   8192UL
 
 
@@ -0,0 +1,320 @@
+/*
+@file    EVE_bitmap.c
+@brief   bitmap handle manager, images are bound to handles once and the handle setup is appended from RAM_G
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_bitmap.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- added EVE_bitmap_draw_image_burst() and EVE_BITMAP_FLASH() for images that are drawn from the external flash
+
+*/
+
+#include "EVE_bitmap.h"
+#include "EVE_snapshot.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+#define EVE_BITMAP_BOUND   1U
+#define EVE_BITMAP_CLAIMED 2U
+
+static EVE_bitmap_image bitmap_images[EVE_BITMAP_HANDLES];
+static uint8_t bitmap_state[EVE_BITMAP_HANDLES];
+static uint32_t bitmap_setup[EVE_BITMAP_SETUP_SIZE / 4U];
+static uint32_t bitmap_address;
+static uint16_t bitmap_words; /* length of the setup, 0 when nothing is bound */
+static uint8_t bitmap_changed;
+
+#if EVE_GEN > 2
+/* block sizes of the ASTC formats, width << 4 | height, in the order of EVE_COMPRESSED_RGBA_ASTC_4x4_KHR ... */
+static const uint8_t bitmap_astc_blocks[14] =
+{
+	0x44, 0x54, 0x55, 0x65, 0x66, 0x85, 0x86, 0x88, 0xa5, 0xa6, 0xa8, 0xaa, 0xca, 0xcc
+};
+#endif
+
+
+void EVE_bitmap_init(uint32_t address)
+{
+	uint8_t handle;
+
+	for(handle = 0; handle < EVE_BITMAP_HANDLES; handle++)
+	{
+		bitmap_state[handle] = 0;
+	}
+	bitmap_state[EVE_BITMAP_SCRATCH] = EVE_BITMAP_CLAIMED;
+	bitmap_state[EVE_SNAPSHOT_HANDLE] = EVE_BITMAP_CLAIMED; /* EVE_snapshot.c sets it up in every frame it draws a snapshot */
+	bitmap_address = address;
+	bitmap_words = 0;
+	bitmap_changed = 0;
+}
+
+
+/* reserves a handle for something else than an image, returns 0 if it is not free */
+uint8_t EVE_bitmap_claim(uint8_t handle)
+{
+	if((handle >= EVE_BITMAP_HANDLES) || (bitmap_state[handle] != 0))
+	{
+		return 0;
+	}
+	bitmap_state[handle] = EVE_BITMAP_CLAIMED;
+	return 1;
+}
+
+
+/* returns the first free handle or EVE_BITMAP_NONE */
+uint8_t EVE_bitmap_bind(const EVE_bitmap_image *image)
+{
+	uint8_t handle;
+
+	for(handle = 0; handle < EVE_BITMAP_HANDLES; handle++)
+	{
+		if(bitmap_state[handle] == 0)
+		{
+			bitmap_state[handle] = EVE_BITMAP_BOUND;
+			bitmap_images[handle] = *image;
+			bitmap_changed = 42;
+			return handle;
+		}
+	}
+	return EVE_BITMAP_NONE;
+}
+
+
+/* changes the image of a bound handle, like for the frames of an animation, nothing is sent if it is the same image */
+uint8_t EVE_bitmap_rebind(uint8_t handle, const EVE_bitmap_image *image)
+{
+	EVE_bitmap_image *slot;
+
+	if((handle >= EVE_BITMAP_HANDLES) || (bitmap_state[handle] != EVE_BITMAP_BOUND))
+	{
+		return EVE_BITMAP_NONE;
+	}
+
+	slot = &bitmap_images[handle];
+	if((slot->address == image->address) && (slot->format == image->format) &&
+		(slot->width == image->width) && (slot->height == image->height) &&
+		(slot->stride == image->stride) && (slot->filter == image->filter))
+	{
+		return handle;
+	}
+
+	*slot = *image;
+	bitmap_changed = 42;
+	return handle;
+}
+
+
+void EVE_bitmap_release(uint8_t handle)
+{
+	if((handle < EVE_BITMAP_HANDLES) && (handle != EVE_BITMAP_SCRATCH) && (handle != EVE_SNAPSHOT_HANDLE))
+	{
+		if(bitmap_state[handle] == EVE_BITMAP_BOUND)
+		{
+			bitmap_changed = 42;
+		}
+		bitmap_state[handle] = 0;
+	}
+}
+
+
+const EVE_bitmap_image *EVE_bitmap_get(uint8_t handle)
+{
+	if((handle < EVE_BITMAP_HANDLES) && (bitmap_state[handle] == EVE_BITMAP_BOUND))
+	{
+		return &bitmap_images[handle];
+	}
+	return NULL;
+}
+
+
+/* bytes per line and number of lines for BITMAP_LAYOUT */
+static void bitmap_layout(const EVE_bitmap_image *image, uint32_t *stride, uint32_t *lines)
+{
+	uint32_t width = image->width;
+
+	*lines = image->height;
+
+#if EVE_GEN > 2
+	if((image->format >= EVE_COMPRESSED_RGBA_ASTC_4x4_KHR) && (image->format <= EVE_COMPRESSED_RGBA_ASTC_12x12_KHR))
+	{
+		uint8_t block = bitmap_astc_blocks[image->format - EVE_COMPRESSED_RGBA_ASTC_4x4_KHR];
+		uint32_t block_w = (uint32_t) block >> 4;
+		uint32_t block_h = (uint32_t) block & 15UL;
+
+		*stride = ((width + block_w - 1UL) / block_w) * 16UL;
+		*lines = (image->height + block_h - 1UL) / block_h;
+	}
+	else
+#endif
+	{
+		switch(image->format)
+		{
+			case EVE_L1:
+				*stride = (width + 7UL) / 8UL;
+				break;
+			case EVE_L2:
+				*stride = (width + 3UL) / 4UL;
+				break;
+			case EVE_L4:
+				*stride = (width + 1UL) / 2UL;
+				break;
+			case EVE_ARGB1555:
+			case EVE_ARGB4:
+			case EVE_RGB565:
+				*stride = width * 2UL;
+				break;
+			default: /* L8, RGB332, ARGB2 and the paletted formats */
+				*stride = width;
+				break;
+		}
+	}
+
+	if(image->stride != 0)
+	{
+		*stride = image->stride;
+	}
+}
+
+
+/* writes the setup lines for one handle to lines, returns the number of lines */
+static uint16_t bitmap_lines(uint8_t handle, const EVE_bitmap_image *image, uint32_t *lines)
+{
+	uint32_t format = image->format;
+	uint32_t stride;
+	uint32_t rows;
+	uint32_t width = image->width;
+	uint32_t height = image->height;
+	uint16_t words = 0;
+
+	bitmap_layout(image, &stride, &rows);
+
+#if EVE_GEN > 2
+	if(format >= EVE_COMPRESSED_RGBA_ASTC_4x4_KHR)
+	{
+		format = EVE_GLFORMAT;
+	}
+#endif
+
+	lines[words++] = BITMAP_HANDLE(handle);
+#if EVE_GEN > 2
+	lines[words++] = BITMAP_SOURCE2((image->address >> 23) & 1UL, image->address);
+#else
+	lines[words++] = BITMAP_SOURCE(image->address);
+#endif
+	lines[words++] = BITMAP_LAYOUT(format, stride, rows);
+	lines[words++] = BITMAP_LAYOUT_H(stride, rows);
+	lines[words++] = BITMAP_SIZE(image->filter, EVE_BORDER, EVE_BORDER, width, height);
+	lines[words++] = BITMAP_SIZE_H(width, height);
+#if EVE_GEN > 2
+	if(format == EVE_GLFORMAT)
+	{
+		lines[words++] = BITMAP_EXT_FORMAT(image->format);
+	}
+#endif
+	return words;
+}
+
+
+/* builds the setup lines for all bound handles */
+static void bitmap_build(void)
+{
+	uint16_t words = 0;
+	uint8_t handle;
+
+	for(handle = 0; handle < EVE_BITMAP_HANDLES; handle++)
+	{
+		if(bitmap_state[handle] == EVE_BITMAP_BOUND)
+		{
+			words += bitmap_lines(handle, &bitmap_images[handle], &bitmap_setup[words]);
+		}
+	}
+
+	if(words != 0)
+	{
+		bitmap_setup[words++] = BITMAP_HANDLE(0);
+	}
+	bitmap_words = words;
+}
+
+
+/* to be used right after CMD_DLSTART */
+void EVE_bitmap_setup_burst(void)
+{
+	if(bitmap_changed != 0)
+	{
+		bitmap_changed = 0;
+		bitmap_build();
+
+		if(bitmap_words != 0)
+		{
+			spi_transmit_burst(CMD_MEMWRITE);
+			spi_transmit_burst(bitmap_address);
+			spi_transmit_burst(bitmap_words * 4UL);
+			private_words_write_burst(bitmap_setup, bitmap_words);
+		}
+	}
+
+	if(bitmap_words != 0)
+	{
+		EVE_cmd_append_burst(bitmap_address, bitmap_words * 4UL);
+	}
+}
+
+
+/* to be used between DL_BEGIN | EVE_BITMAPS and DL_END, expects the default VERTEX_FORMAT(4) outside of 0...511 */
+void EVE_bitmap_draw_burst(uint8_t handle, uint8_t cell, int16_t x, int16_t y)
+{
+	if(((uint16_t) x < 512U) && ((uint16_t) y < 512U))
+	{
+		spi_transmit_burst(VERTEX2II((uint32_t) x, (uint32_t) y, handle, cell));
+	}
+	else
+	{
+		spi_transmit_burst(BITMAP_HANDLE(handle));
+		spi_transmit_burst(CELL(cell));
+		spi_transmit_burst(VERTEX2F((uint32_t) x * 16UL, (uint32_t) y * 16UL));
+	}
+}
+
+
+/* draws an image that is not bound to a handle, like a background from the external flash, with the setup inline */
+void EVE_bitmap_draw_image_burst(const EVE_bitmap_image *image, uint8_t handle, int16_t x, int16_t y)
+{
+	uint32_t lines[7];
+	uint16_t words = bitmap_lines(handle, image, lines);
+
+	private_words_write_burst(lines, words);
+	spi_transmit_burst(DL_BEGIN | EVE_BITMAPS);
+	EVE_bitmap_draw_burst(handle, 0, x, y);
+	spi_transmit_burst(DL_END);
+}
+
+
+#endif /* EVE_NO_BURST */
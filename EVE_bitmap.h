@@ -0,0 +1,125 @@
+/*
+@file    EVE_bitmap.h
+@brief   bitmap handle manager, images are bound to handles once and the handle setup is appended from RAM_G
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Using EVE_cmd_setbitmap_burst() for an image in every frame sends the same setup for the same image over and over again.
+This module binds images to bitmap handles once and keeps the BITMAP_HANDLE / BITMAP_SOURCE / BITMAP_LAYOUT /
+BITMAP_SIZE lines for all bound handles in RAM_G.
+EVE_bitmap_setup_burst() at the start of the display-list adds these with CMD_APPEND, three words no matter how
+many images are bound, after a change it also updates the copy in RAM_G with CMD_MEMWRITE.
+From then on the images are drawn by handle with VERTEX2II.
+
+static const EVE_bitmap_image logo = {MEM_LOGO, EVE_ARGB1555, 56, 56, 0, EVE_NEAREST};
+
+EVE_bitmap_init(MEM_BITMAP_SETUP); <- EVE_BITMAP_SETUP_SIZE bytes in RAM_G
+EVE_bitmap_claim(12); <- the handle is used by EVE_cmd_setfont2()
+logo_handle = EVE_bitmap_bind(&logo);
+
+and in the frame:
+
+EVE_cmd_dl_burst(CMD_DLSTART);
+EVE_bitmap_setup_burst();
+...
+EVE_cmd_dl_burst(DL_BEGIN | EVE_BITMAPS);
+EVE_bitmap_draw_burst(logo_handle, 0, EVE_HSIZE - 58, 5);
+EVE_cmd_dl_burst(DL_END);
+
+Handles 16 to 31 are used by the ROM fonts, EVE_BITMAP_SCRATCH is used by the co-processor widgets
+and EVE_SNAPSHOT_HANDLE by EVE_snapshot.c, these are never handed out.
+Handles that are assigned with EVE_cmd_setfont2() or EVE_cmd_romfont() need to be claimed with EVE_bitmap_claim() first.
+The stride is calculated from the format and the width when it is set to 0.
+ASTC formats are set up with BITMAP_EXT_FORMAT, for images in the external flash use EVE_BITMAP_FLASH(flash address)
+as the address, the flash address needs to be a multiple of 64.
+Images are drawn directly from the flash only when it is in full-speed mode, see EVE_flashdl_ready().
+tools/eve_astc.py encodes PNG images to ASTC, puts the blocks in the order BT81x expects and packs these
+into a binary for the flash with a header that has EVE_bitmap_image initializers for them.
+
+A full-screen background from the flash does not need RAM_G or an upload, a handle that is only used for it
+can be set up in the frame:
+
+static const EVE_bitmap_image background = ASTC_BACKGROUND_IMAGE;
+EVE_bitmap_claim(13); <- once, so the handle is not handed out by EVE_bitmap_bind()
+...
+EVE_bitmap_draw_image_burst(&background, 13, 0, 0);
+The image descriptors are copied, these do not need to stay valid.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- added EVE_bitmap_draw_image_burst() and EVE_BITMAP_FLASH() for images that are drawn from the external flash
+- EVE_bitmap_init() reserves EVE_SNAPSHOT_HANDLE as well
+
+*/
+
+#pragma once
+
+#ifndef EVE_BITMAP_H_
+#define EVE_BITMAP_H_
+
+#include "EVE_commands.h"
+
+#if !defined (EVE_NO_BURST)
+
+/* the handle that is used by the co-processor widgets, see CMD_SETSCRATCH */
+#if !defined (EVE_BITMAP_SCRATCH)
+#define EVE_BITMAP_SCRATCH 15U
+#endif
+
+#define EVE_BITMAP_HANDLES 16U
+#define EVE_BITMAP_NONE 0xffU
+
+/* size of the setup in RAM_G, seven lines per handle and the BITMAP_HANDLE(0) at the end */
+#define EVE_BITMAP_SETUP_SIZE (((EVE_BITMAP_HANDLES * 7U) + 1U) * 4U)
+
+#if EVE_GEN > 2
+/* the address for BITMAP_SOURCE2 of an image in the external flash */
+#define EVE_BITMAP_FLASH(address) (0x800000UL | ((uint32_t) (address) / 32UL))
+#endif
+
+typedef struct
+{
+	uint32_t address; /* BITMAP_SOURCE */
+	uint16_t format;  /* EVE_ARGB1555, EVE_RGB565 ... or EVE_COMPRESSED_RGBA_ASTC_4x4_KHR ... */
+	uint16_t width;
+	uint16_t height;
+	uint16_t stride;  /* bytes per line or per row of ASTC blocks, 0 to calculate it */
+	uint8_t filter;   /* EVE_NEAREST or EVE_BILINEAR */
+} EVE_bitmap_image;
+
+void EVE_bitmap_init(uint32_t address);
+uint8_t EVE_bitmap_claim(uint8_t handle);
+uint8_t EVE_bitmap_bind(const EVE_bitmap_image *image);
+uint8_t EVE_bitmap_rebind(uint8_t handle, const EVE_bitmap_image *image);
+void EVE_bitmap_release(uint8_t handle);
+const EVE_bitmap_image *EVE_bitmap_get(uint8_t handle);
+void EVE_bitmap_setup_burst(void);
+void EVE_bitmap_draw_burst(uint8_t handle, uint8_t cell, int16_t x, int16_t y);
+void EVE_bitmap_draw_image_burst(const EVE_bitmap_image *image, uint8_t handle, int16_t x, int16_t y);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_BITMAP_H_ */
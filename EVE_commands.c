@@ -149,19 +149,33 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
   Michael Wachs that these are identical - they weren't prior to V5
 - removed EVE_start_command()
 - Bugfix: EVE_init() was only checking the first two bits of REG_CPURESET and ignored the bit for the audio-engine, not an issue but not correct either.
+- split this file into EVE_commands.c with the helper, init and cmd-burst functions, EVE_commands_copro.c with the co-processor commands
+  that are not used in display lists, EVE_commands_dl.c with the display-list functions and EVE_commands_burst.c with the _burst functions
+- made eve_begin_cmd() and private_string_write() non-static again, these are shared with the other EVE_commands_xxx.c files now
+- changed EVE_init_flash() to use EVE_cmd_flashattach() instead of EVE_cmd_dl(CMD_FLASHATTACH)
+- removed the old EVE_start_command() that was disabled with #if 0
+- rewrote private_string_write() to transfer 32 bit words and to test four characters at once for the terminating zero
+- removed the limit of 249 characters for strings, non-burst commands split longer strings into several transfers
+- added private_string_write_burst(), private_string_write_len(), private_words_write() and their _burst versions
+- added EVE_pack_string()
+- string_load() uses memcpy() and string_word() reads thru a may_alias type, the word reads are only done with GCC and clang
+- added a host-side formatter that packs the converted string directly into words for the _var functions on FT81x
+- the formatter limits field widths and precisions to 255 and splits long non-burst strings like private_string_write()
+  and for EVE_cmd_number_fixed()
+- added private_block_write_burst() for EVE_cmd_memwrite_burst()
+- split EVE_init() into steps without changing the order and added EVE_init_splash(), EVE_init_finish() and EVE_get_first_pixel_us()
+- moved the co-processor reset out of EVE_busy() into eve_reset_copro() and added EVE_warm_mark() and EVE_init_warm()
+- EVE_start_cmd_burst() sets up EVE_dma_buffer for targets with a buffer per thread, EVE_DMA_THREAD
+- private_words_write_burst() copies the words into EVE_dma_buffer with a single memcpy() when EVE_DMA is used
+- the formatting on the host accepts a precision of up to 255 digits like the width, EVE_cmd_number_fixed() limits the decimals to 254
+- EVE_init_splash() returns 0 for a list that is larger than RAM_DL
 
 
 */
 
+#include <string.h>
 #include "EVE.h"
-
-#if EVE_GEN > 2
-#include <stdarg.h>
-#endif
-
-/* EVE Memory Commands - used with EVE_memWritexx and EVE_memReadxx */
-#define MEM_WRITE	0x80 /* EVE Host Memory Write */
-#define MEM_READ	0x00 /* EVE Host Memory Read */
+#include "EVE_commands_private.h"
 
 volatile uint8_t cmd_burst = 0; /* flag to indicate cmd-burst is active */
 
@@ -296,6 +310,44 @@ void EVE_memWrite_sram_buffer(uint32_t ftAddress, const uint8_t *data, uint32_t
 }
 
 
+/* reset the co-processor and restore what the reset changes, used for the fault recovery and by EVE_init_warm() */
+static void eve_reset_copro(void)
+{
+	#if EVE_GEN > 2
+	uint16_t copro_patch_pointer;
+	uint32_t ftAddress;
+
+	copro_patch_pointer = EVE_memRead16(REG_COPRO_PATCH_DTR);
+	#endif
+
+	EVE_memWrite8(REG_CPURESET, 1);   /* hold co-processor engine in the reset condition */
+	EVE_memWrite16(REG_CMD_READ, 0);  /* set REG_CMD_READ to 0 */
+	EVE_memWrite16(REG_CMD_WRITE, 0); /* set REG_CMD_WRITE to 0 */
+	EVE_memWrite32(REG_CMD_DL, 0);    /* reset REG_CMD_DL to 0 as required by the BT81x programming guide, should not hurt FT8xx */
+	EVE_memWrite8(REG_CPURESET, 0);  /* set REG_CMD_WRITE to 0 to restart the co-processor engine*/
+
+	#if EVE_GEN > 2
+
+	EVE_memWrite16(REG_COPRO_PATCH_DTR, copro_patch_pointer);
+	DELAY_MS(5); /* just to be safe */
+	ftAddress = REG_CMDB_WRITE;
+
+	EVE_cs_set();
+	spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
+	spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
+	spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
+
+	spi_transmit_32(CMD_FLASHATTACH);
+	spi_transmit_32(CMD_FLASHFAST);
+	EVE_cs_clear();
+
+	EVE_memWrite8(REG_PCLK, EVE_PCLK); /* restore REG_PCLK in case it was set to zero by an error */
+	DELAY_MS(5); /* just to be safe */
+
+	#endif
+}
+
+
 /* Check if the graphics processor completed executing the current command list. */
 /* REG_CMDB_SPACE == 0xffc -> command fifo is empty */
 /* (REG_CMDB_SPACE & 0x03) != 0 -> we have a co-processor fault */
@@ -314,38 +366,7 @@ uint8_t EVE_busy(void)
 
 	if((space & 0x3) != 0) /* we have a co-processor fault, make EVE play with us again */
 	{
-		#if EVE_GEN > 2
-		uint16_t copro_patch_pointer;
-		uint32_t ftAddress;
-
-		copro_patch_pointer = EVE_memRead16(REG_COPRO_PATCH_DTR);
-		#endif
-
-		EVE_memWrite8(REG_CPURESET, 1);   /* hold co-processor engine in the reset condition */
-		EVE_memWrite16(REG_CMD_READ, 0);  /* set REG_CMD_READ to 0 */
-		EVE_memWrite16(REG_CMD_WRITE, 0); /* set REG_CMD_WRITE to 0 */
-		EVE_memWrite32(REG_CMD_DL, 0);    /* reset REG_CMD_DL to 0 as required by the BT81x programming guide, should not hurt FT8xx */
-		EVE_memWrite8(REG_CPURESET, 0);  /* set REG_CMD_WRITE to 0 to restart the co-processor engine*/
-
-		#if EVE_GEN > 2
-
-		EVE_memWrite16(REG_COPRO_PATCH_DTR, copro_patch_pointer);
-		DELAY_MS(5); /* just to be safe */
-		ftAddress = REG_CMDB_WRITE;
-
-		EVE_cs_set();
-		spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
-		spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
-		spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
-
-		spi_transmit_32(CMD_FLASHATTACH);
-		spi_transmit_32(CMD_FLASHFAST);
-		EVE_cs_clear();
-
-		EVE_memWrite8(REG_PCLK, EVE_PCLK); /* restore REG_PCLK in case it was set to zero by an error */
-		DELAY_MS(5); /* just to be safe */
-
-		#endif
+		eve_reset_copro();
 	}
 
 	if(space != 0xffc)
@@ -380,7 +401,7 @@ void EVE_cmd_execute(void)
 
 
 /* begin a co-processor command, this is used for non-display-list and non-burst-mode commands */
-static void eve_begin_cmd(uint32_t command)
+void eve_begin_cmd(uint32_t command)
 {
 	uint32_t ftAddress;
 
@@ -417,6 +438,37 @@ void private_block_write(const uint8_t *data, uint16_t len)
 }
 
 
+#if !defined (EVE_NO_BURST)
+/* the same as private_block_write() but for cmd-burst, the bytes are packed into words for spi_transmit_burst() */
+void private_block_write_burst(const uint8_t *data, uint32_t len)
+{
+	uint32_t word;
+	uint8_t index;
+
+	while(len > 3)
+	{
+		word = fetch_flash_byte(data);
+		word |= ((uint32_t) fetch_flash_byte(data+1)) << 8;
+		word |= ((uint32_t) fetch_flash_byte(data+2)) << 16;
+		word |= ((uint32_t) fetch_flash_byte(data+3)) << 24;
+		spi_transmit_burst(word);
+		data += 4;
+		len -= 4;
+	}
+
+	if(len > 0) /* the last 1...3 bytes, padded with zeros */
+	{
+		word = 0;
+		for(index = 0; index < len; index++)
+		{
+			word |= ((uint32_t) fetch_flash_byte(data+index)) << (index * 8U);
+		}
+		spi_transmit_burst(word);
+	}
+}
+#endif
+
+
 void block_transfer(const uint8_t *data, uint32_t len)
 {
 	uint32_t bytes_left;
@@ -443,2689 +495,1175 @@ void block_transfer(const uint8_t *data, uint32_t len)
 }
 
 /*----------------------------------------------------------------------------------------------------------------------------*/
-/*---- co-processor commands that are not used in displays lists, these are not to be used with burst transfers --------------*/
+/*------------- patching and initialisation ----------------------------------------------------------------------------------*/
 /*----------------------------------------------------------------------------------------------------------------------------*/
 
+#if EVE_GEN > 2
 
-/* BT817 / BT818 */
-#if EVE_GEN > 3
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* write "num" bytes from src in RAM_G to to the external flash on a BT81x board at address dest */
-/* note: dest must be 4096-byte aligned, src must be 4-byte aligned, num must be a multiple of 4096 */
-/* note: EVE will not do anything if the alignment requirements are not met */
-/* note: the address ptr is relative to the flash so the first address is 0x00000000 not 0x800000 */
-/* note: this looks exactly the same as EVE_cmd_flashupdate() but it needs the flash to be empty */
-void EVE_cmd_flashprogram(uint32_t dest, uint32_t src, uint32_t num)
-{
-	eve_begin_cmd(CMD_FLASHPROGRAM);
-	spi_transmit_32(dest);
-	spi_transmit_32(src);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_fontcache(uint32_t font, int32_t ptr, uint32_t num)
-{
-	eve_begin_cmd(CMD_FONTCACHE);
-	spi_transmit_32(font);
-	spi_transmit_32(ptr);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_fontcachequery(uint32_t *total, int32_t *used)
+/* switch the FLASH attached to a BT815/BT816 to full-speed mode, returns 0 for failing to do so */
+uint8_t EVE_init_flash(void)
 {
-	uint16_t cmdoffset;
+	uint8_t timeout = 0;
+	uint8_t status;
 
-	eve_begin_cmd(CMD_FONTCACHEQUERY);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+	status = EVE_memRead8(REG_FLASH_STATUS); /* should be 0x02 - FLASH_STATUS_BASIC, power-up is done and the attached flash is detected */
 
-	if(total)
+	while(status == 0) /* FLASH_STATUS_INIT - we are somehow still in init, give it a litte more time, this should never happen */
 	{
-		*total = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
+		status = EVE_memRead8(REG_FLASH_STATUS);
+		DELAY_MS(1);
+		timeout++;
+		if(timeout > 100) /* 100ms and still in init, lets call quits now and exit with an error */
+		{
+			return 0;
+		}
 	}
-	if(used)
+
+	if(status == 1) /* FLASH_STATUS_DETACHED - no flash was found during init, no flash present or the detection failed, but have hope and let the BT81x have annother try */
 	{
-		*used = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
+		EVE_cmd_flashattach(); /* includes waiting for completion */
+		status = EVE_memRead8(REG_FLASH_STATUS);
+		if(status != 2) /* still not in FLASH_STATUS_BASIC, time to give up */
+		{
+			return 0;
+		}
 	}
-}
 
+	if(status == 2) /* FLASH_STATUS_BASIC - flash detected and ready for action, lets move it up to FLASH_STATUS_FULL */
+	{
+		uint32_t result;
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_getimage(uint32_t *source, uint32_t *fmt, uint32_t *width, uint32_t *height, uint32_t *palette)
-{
-	uint16_t cmdoffset;
-
-	eve_begin_cmd(CMD_GETIMAGE);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+		result = EVE_cmd_flashfast();
 
-	if(palette)
-	{
-		*palette = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
-	}
-	if(height)
-	{
-		*height = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
-	}
-	if(width)
-	{
-		*width = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 12) & 0xfff));
-	}
-	if(fmt)
-	{
-		*fmt = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 16) & 0xfff));
+		if(result == 0) /* cmd_flashfast was successful */
+		{
+			return 1;
+		}
+		else /* room for improvement, cmd_flashfast provided an error code but there is no way to return it without returning a value that is FALSE all the same */
+		{
+			return 0;
+		}
 	}
-	if(source)
+
+	if(status == 3) /* FLASH_STATUS_FULL - we are already there, why has this function been called? */
 	{
-		*source = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 20) & 0xfff));
+		return 1;
 	}
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_linetime(uint32_t dest)
-{
-	eve_begin_cmd(CMD_LINETIME);
-	spi_transmit_32(dest);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_newlist(uint32_t adr)
-{
-	eve_begin_cmd(CMD_NEWLIST);
-	spi_transmit_32(adr);
-	EVE_cs_clear();
-	while (EVE_busy());
+	return 0;
 }
 
+#endif /* EVE_GEN > 2 */
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* This command sets REG_PCLK_FREQ to generate the closest possible frequency to the one requested. */
-/* Returns the frequency achieved or zero if no frequency was found. */
-uint32_t EVE_cmd_pclkfreq(uint32_t ftarget, int32_t rounding)
-{
-	uint16_t cmdoffset;
 
-	eve_begin_cmd(CMD_PCLKFREQ);
-	spi_transmit_32(ftarget);
-	spi_transmit_32(rounding);
-	spi_transmit_32(0);
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-	cmdoffset -= 4;
-	cmdoffset &= 0x0fff;
-	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
-}
+/* FT811 / FT813 binary-blob from FTDIs AN_336 to patch the touch-engine for Goodix GT911 / GT9271 touch controllers */
+#if defined (EVE_HAS_GT911)
 
+#if	defined (__AVR__)
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#endif
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_wait(uint32_t us)
+const uint16_t EVE_GT911_len = 1184;
+const uint8_t EVE_GT911_data[1184] PROGMEM =
 {
-	eve_begin_cmd(CMD_WAIT);
-	spi_transmit_32(us);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
+	26,255,255,255,32,32,48,0,4,0,0,0,2,0,0,0,
+	34,255,255,255,0,176,48,0,120,218,237,84,221,111,84,69,20,63,51,179,93,160,148,101,111,76,5,44,141,123,111,161,11,219,154,16,9,16,17,229,156,75,26,11,13,21,227,3,16,252,184,179,
+	45,219,143,45,41,125,144,72,67,100,150,71,189,113,18,36,17,165,100,165,198,16,32,17,149,196,240,128,161,16,164,38,54,240,0,209,72,130,15,38,125,48,66,82,30,76,19,31,172,103,46,
+	139,24,255,4,227,157,204,156,51,115,102,206,231,239,220,5,170,94,129,137,75,194,216,98,94,103,117,115,121,76,131,177,125,89,125,82,123,60,243,58,142,242,204,185,243,188,118,156,
+	227,155,203,238,238,195,251,205,229,71,92,28,169,190,184,84,143,113,137,53,244,103,181,237,87,253,113,137,233,48,12,198,165,181,104,139,25,84,253,155,114,74,191,0,54,138,163,
+	12,62,131,207,129,23,217,34,91,31,128,65,246,163,175,213,8,147,213,107,35,203,94,108,3,111,40,171,83,24,15,165,177,222,116,97,23,188,140,206,150,42,102,181,87,78,86,182,170,134,
+	215,241,121,26,243,252,2,76,115,217,139,222,206,173,136,132,81,61,35,185,39,113,23,46,199,76,178,54,151,183,224,0,40,189,28,149,182,58,131,79,152,30,76,34,98,234,162,216,133,141,
+	102,39,170,40,192,101,53,201,146,191,37,77,44,177,209,74,211,5,206,187,5,6,216,47,53,96,123,22,50,103,251,192,84,17,74,227,185,56,106,51,91,161,96,182,163,48,171,141,139,65,152,
+	66,66,11,102,43,158,75,36,80,147,184,147,139,112,17,235,216,103,111,239,245,92,10,175,194,40,44,58,125,5,59,112,50,103,245,4,78,192,5,156,194,51,60,191,134,75,110,173,237,46,192,
+	121,156,192,115,184,218,120,67,63,115,46,11,102,10,97,232,50,235,114,182,148,118,178,41,188,12,135,77,202,124,12,96,238,35,161,234,189,129,23,249,212,139,230,25,53,48,205,52,93,
+	163,117,53,154,170,81,85,163,178,70,69,66,167,241,14,46,241,1,226,136,152,179,197,59,184,148,254,49,132,48,15,176,137,192,76,131,196,105,104,162,86,81,160,165,255,26,173,162,137,
+	86,145,210,183,192,55,175,194,211,60,91,120,230,184,174,27,41,131,155,40,224,29,87,179,232,16,55,55,7,165,147,81,23,165,49,101,54,224,75,180,81,108,18,29,226,69,225,110,175,224,
+	42,212,25,47,130,193,110,234,192,215,252,56,74,162,24,46,251,174,54,106,68,245,14,9,155,160,22,120,207,104,240,29,90,178,140,28,24,220,47,166,112,61,251,208,192,111,56,239,238,
+	93,255,251,62,99,32,193,75,61,190,235,123,229,110,218,194,85,79,225,59,98,20,238,227,235,220,11,221,149,25,180,116,194,159,111,96,192,24,213,59,139,179,156,215,69,230,19,24,35,
+	135,117,206,171,206,162,67,129,234,61,235,11,104,103,84,64,223,167,254,40,163,101,92,84,43,150,46,249,219,205,7,116,11,91,104,61,57,75,223,8,48,25,28,119,252,222,113,49,86,249,
+	74,180,211,156,181,61,215,168,157,7,251,199,150,242,250,91,58,132,94,121,7,53,151,139,98,6,165,153,69,214,32,110,211,100,101,31,89,45,81,98,23,205,205,197,209,109,186,198,35,
+	141,191,249,25,60,132,223,153,251,98,20,239,146,139,20,217,250,41,250,137,58,177,90,57,79,51,108,233,20,253,194,187,49,222,205,114,141,96,48,175,219,107,54,111,138,22,154,103,
+	108,79,58,252,179,178,79,164,195,2,153,36,39,170,199,201,167,197,85,106,8,59,177,81,46,56,2,230,75,114,17,55,112,188,65,208,137,77,114,10,115,55,58,208,197,173,122,87,6,140,
+	110,42,208,124,163,70,108,241,104,18,245,98,214,187,134,53,42,221,22,182,133,211,116,148,177,194,209,192,85,90,199,58,55,203,2,229,19,137,187,161,228,154,112,203,145,125,244,
+	188,220,118,228,41,201,181,41,195,144,215,183,51,80,250,21,217,16,217,200,235,109,227,188,122,218,142,60,170,224,112,240,184,130,229,224,113,5,223,148,163,80,165,183,130,187,
+	132,116,64,238,161,85,220,115,139,205,98,227,244,29,102,125,7,37,243,123,223,11,26,92,63,243,116,61,191,138,123,244,160,84,186,74,31,5,174,247,119,135,199,248,253,135,242,97,
+	102,145,190,144,14,85,238,221,231,193,158,48,205,25,120,248,15,220,29,158,9,70,185,30,103,229,33,254,23,237,160,172,62,193,90,222,224,232,14,200,56,90,104,142,227,120,110,6,
+	21,211,203,65,150,99,151,220,247,87,164,50,159,49,239,234,58,142,0,109,108,123,18,79,227,36,100,248,222,205,96,127,120,26,171,228,69,63,36,17,252,200,17,116,242,187,227,88,143,
+	247,2,75,191,6,130,59,188,11,55,240,31,243,122,152,226,183,207,154,73,188,39,219,43,105,222,87,41,143,141,140,175,73,112,184,252,61,184,16,90,250,35,168,82,119,176,57,116,94,
+	200,150,22,190,179,44,104,12,235,84,149,102,252,89,154,193,99,228,106,242,125,248,64,194,255,223,127,242,83,11,255,2,70,214,226,128,0,0
+};
+#endif
 
-#endif /* EVE_GEN > 3 */
 
+static uint32_t eve_first_pixel; /* REG_CLOCK at the time the pixel clock was started */
 
-/* BT815 / BT816 */
-#if EVE_GEN > 2
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* this command clears the graphics systems flash cache and to do so it needs to be executed with empty display lists */
-/* note: looks like overkill to clear both display lists but this is taken from BRT sample code */
-void EVE_cmd_clearcache(void)
+/* power-up until EVE answers, returns 0 if it does not */
+static uint8_t eve_init_start(uint8_t silence)
 {
-	EVE_cmd_dl(CMD_DLSTART);
-	EVE_cmd_dl(CMD_SWAP);
-	while (EVE_busy());
-
-	EVE_cmd_dl(CMD_DLSTART);
-	EVE_cmd_dl(CMD_SWAP);
-	while (EVE_busy());
-
-	EVE_cmd_dl(CMD_CLEARCACHE);
-	while (EVE_busy());
-}
+	uint8_t chipid = 0;
+	uint16_t timeout = 0;
 
+	EVE_pdn_set();
+	DELAY_MS(6); /* minimum time for power-down is 5ms */
+	EVE_pdn_clear();
+	DELAY_MS(21); /* minimum time to allow from rising PD_N to first access is 20ms */
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHATTACH); followed by EVE_cmd_execute(); would work as well */
-void EVE_cmd_flashattach(void)
-{
-	eve_begin_cmd(CMD_FLASHATTACH);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
+/*	EVE_cmdWrite(EVE_CORERST,0); */ /* reset, only required for warm-start if PowerDown line is not used */
 
+	#if defined (EVE_HAS_CRYSTAL)
+	EVE_cmdWrite(EVE_CLKEXT,0);	/* setup EVE for external clock */
+	#else
+	EVE_cmdWrite(EVE_CLKINT,0);	/* setup EVE for internal clock */
+	#endif
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHDETACH); followed by EVE_cmd_execute(); would work as well */
-void EVE_cmd_flashdetach(void)
-{
-	eve_begin_cmd(CMD_FLASHDETACH);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
+	#if EVE_GEN > 2
+	EVE_cmdWrite(EVE_CLKSEL,0x46); /* set clock to 72 MHz */
+	#endif
 
+	EVE_cmdWrite(EVE_ACTIVE,0);	/* start EVE */
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHERASE); followed by EVE_cmd_execute(); would work as well */
-void EVE_cmd_flasherase(void)
-{
-	eve_begin_cmd(CMD_FLASHERASE);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
+	/*
+	BRT AN033 BT81X_Series_Programming_Guide V1.2 added a delay of at least 300ms as a requirement after sending command ACTIVE.
+	Together with the sentence: "Ensure that there is no SPI access during this time."
+	AN033 BT81X_Series_Programming_Guide V2.0 removed this delay requirement again.
+	From observation of the startup-behavior of quite a number of displays, reading REG_ID immediately after
+	sending command ACTIVE is not an issue, but a BT815 running at 72MHzs needs about 42ms before it answers anyways. 
+	So I added a fixed delay of 40ms as a compromise, this provides a moment of silence on the SPI
+	without actually delaying the startup.
+	EVE_init_splash() skips this delay and starts polling right away as every millisecond counts there.
+	*/
+	if(silence)
+	{
+		DELAY_MS(40);
+	}
 
+	while(chipid != 0x7C) /* if chipid is not 0x7c, continue to read it until it is, EVE needs a moment for its power on self-test and configuration */
+	{
+		DELAY_MS(1);
+		chipid = EVE_memRead8(REG_ID);
+		timeout++;
+		if(timeout > 400)
+		{
+			return 0;
+		}
+	}
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-uint32_t EVE_cmd_flashfast(void)
-{
-	uint16_t cmdoffset;
+	timeout = 0;
+	while (0x00 != (EVE_memRead8(REG_CPURESET) & 0x07)) /* check if EVE is in working status */
+	{
+		DELAY_MS(1);
+		timeout++;
+		if(timeout > 50) /* experimental, 10 was the lowest value to get the BT815 started with, the touch-controller was the last to get out of reset */
+		{
+			return 0;
+		}
+	}
 
-	eve_begin_cmd(CMD_FLASHFAST);
-	spi_transmit_32(0);
-	EVE_cs_clear();
+	/* tell EVE that we changed the frequency from default to 72MHz for BT8xx */
+	#if EVE_GEN > 2
+	EVE_memWrite32(REG_FREQUENCY, 72000000);
+	#endif
 
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-	cmdoffset -= 4;
-	cmdoffset &= 0x0fff;
-	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+	return 1;
 }
 
 
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHSPIDESEL); followed by EVE_cmd_execute(); would work as well */
-void EVE_cmd_flashspidesel(void)
+static void eve_init_touch_controller(void)
 {
-	eve_begin_cmd(CMD_FLASHSPIDESEL);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* write "num" bytes from src in the external flash on a BT81x board to dest in RAM_G */
-/* note: src must be 64-byte aligned, dest must be 4-byte aligned, num must be a multiple of 4 */
-/* note: EVE will not do anything if the alignment requirements are not met */
-/* note: the src pointer is relative to the flash so the first address is 0x00000000 not 0x800000 */
-void EVE_cmd_flashread(uint32_t dest, uint32_t src, uint32_t num)
-{
-	eve_begin_cmd(CMD_FLASHREAD);
-	spi_transmit_32(dest);
-	spi_transmit_32(src);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_flashsource(uint32_t ptr)
-{
-	eve_begin_cmd(CMD_FLASHSOURCE);
-	spi_transmit_32(ptr);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* write "num" bytes from the BT81x SPI interface dest in RAM_G */
-/* note: raw direct access, not really useful for anything */
-void EVE_cmd_flashspirx(uint32_t dest, uint32_t num)
-{
-	eve_begin_cmd(CMD_FLASHSPIRX);
-	spi_transmit_32(dest);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* write "num" bytes from *data to the BT81x SPI interface */
-/* note: raw direct access, not really useful for anything */
-void EVE_cmd_flashspitx(uint32_t num, const uint8_t *data)
-{
-	eve_begin_cmd(CMD_FLASHSPITX);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	block_transfer(data, num);
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* write "num" bytes from src in RAM_G to to the external flash on a BT81x board at address dest */
-/* note: dest must be 4096-byte aligned, src must be 4-byte aligned, num must be a multiple of 4096 */
-/* note: EVE will not do anything if the alignment requirements are not met */
-/* note: the address ptr is relative to the flash so the first address is 0x00000000 not 0x800000 */
-void EVE_cmd_flashupdate(uint32_t dest, uint32_t src, uint32_t num)
-{
-	eve_begin_cmd(CMD_FLASHUPDATE);
-	spi_transmit_32(dest);
-	spi_transmit_32(src);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* write "num" bytes from *data to the external flash on a BT81x board at address ptr */
-/* note: ptr must be 256 byte aligned, num must be a multiple of 256 */
-/* note: EVE will not do anything if the alignment requirements are not met */
-/* note: the address ptr is relative to the flash so the first address is 0x00000000 not 0x800000 */
-/* note: on AVR controllers this expects the data to be located in the controllers flash memory */
-void EVE_cmd_flashwrite(uint32_t ptr, uint32_t num, const uint8_t *data)
-{
-	eve_begin_cmd(CMD_FLASHWRITE);
-	spi_transmit_32(ptr);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	if(data)
-	{
-		block_transfer(data, num);
-	}
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_inflate2(uint32_t ptr, uint32_t options, const uint8_t *data, uint32_t len)
-{
-	eve_begin_cmd(CMD_INFLATE2);
-	spi_transmit_32(ptr);
-	spi_transmit_32(options);
-	EVE_cs_clear();
-
-	if(options == 0) /* direct data, not by Media-FIFO or Flash */
-	{
-		if(data)
-		{
-			block_transfer(data, len);
-		}
-	}
-}
-
-#endif /* EVE_GEN > 2 */
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* get the properties of an image after a CMD_LOADIMAGE operation and write the values to the variables that are supplied by pointers
-    uint32 pointer, width, height;
-     EVE_LIB_GetProps(&pointer, &width, &height);
-
-    uint32 width, height;
-     EVE_LIB_GetProps(0, &width, &height);
-*/
-void EVE_cmd_getprops(uint32_t *pointer, uint32_t *width, uint32_t *height)
-{
-	uint16_t cmdoffset;
-
-	eve_begin_cmd(CMD_GETPROPS);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	spi_transmit_32(0);
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-
-	if(pointer)
-	{
-		*pointer = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 12) & 0xfff));
-	}
-	if(width)
-	{
-		*width = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
-	}
-	if(height)
-	{
-		*height = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
-	}
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* address = EVE_cmd_getpr(); */
-uint32_t EVE_cmd_getptr(void)
-{
-	uint16_t cmdoffset;
-
-	eve_begin_cmd(CMD_GETPTR);
-	spi_transmit_32(0);
-
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-	cmdoffset -= 4;
-	cmdoffset &= 0x0fff;
-	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_inflate(uint32_t ptr, const uint8_t *data, uint32_t len)
-{
-	eve_begin_cmd(CMD_INFLATE);
-	spi_transmit_32(ptr);
-	EVE_cs_clear();
-	if(data)
-	{
-		block_transfer(data, len);
-	}
-}
-
-
-/* this is meant to be called outside display-list building, does not support cmd-burst */
-void EVE_cmd_interrupt(uint32_t ms)
-{
-	eve_begin_cmd(CMD_INTERRUPT);
-	spi_transmit_32(ms);
-	EVE_cs_clear();
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_loadimage(uint32_t ptr, uint32_t options, const uint8_t *data, uint32_t len)
-{
-	eve_begin_cmd(CMD_LOADIMAGE);
-	spi_transmit_32(ptr);
-	spi_transmit_32(options);
-	EVE_cs_clear();
-
-#if EVE_GEN > 2
-	if( ((options & EVE_OPT_MEDIAFIFO) == 0) && ((options & EVE_OPT_FLASH) == 0) )/* direct data, neither by Media-FIFO or from Flash */
-#else
-	if((options & EVE_OPT_MEDIAFIFO) == 0) /* direct data, not by Media-FIFO */
-#endif
-	{
-		if(data)
-		{
-			block_transfer(data, len);
-		}
-	}
-}
-
-
-/* this is meant to be called outside display-list building, does not support cmd-burst */
-void EVE_cmd_mediafifo(uint32_t ptr, uint32_t size)
-{
-	eve_begin_cmd(CMD_MEDIAFIFO);
-	spi_transmit_32(ptr);
-	spi_transmit_32(size);
-	EVE_cs_clear();
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_memcpy(uint32_t dest, uint32_t src, uint32_t num)
-{
-	eve_begin_cmd(CMD_MEMCPY);
-	spi_transmit_32(dest);
-	spi_transmit_32(src);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* crc32 = EVE_cmd_memcrc(my_ptr_to_some_memory_region, some_amount_of_bytes); */
-uint32_t EVE_cmd_memcrc(uint32_t ptr, uint32_t num)
-{
-	uint16_t cmdoffset;
-
-	eve_begin_cmd(CMD_MEMCRC);
-	spi_transmit_32(ptr);
-	spi_transmit_32(num);
-	spi_transmit_32(0);
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-	cmdoffset -= 4;
-	cmdoffset &= 0x0fff;
-	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
-}
-
-
-/* this is meant to be called outside display-list building, does not support cmd-burst */
-void EVE_cmd_memset(uint32_t ptr, uint8_t value, uint32_t num)
-{
-	eve_begin_cmd(CMD_MEMSET);
-	spi_transmit_32(ptr);
-	spi_transmit_32((uint32_t) value);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* this is a pointless command, just use one of the EVE_memWrite* helper functions instead to directly write to EVEs memory */
-/*
-void EVE_cmd_memwrite(uint32_t dest, uint32_t num, const uint8_t *data)
-{
-	eve_begin_cmd(CMD_MEMWRITE);
-	spi_transmit_32(dest);
-	spi_transmit_32(num);
-
-	num = (num + 3)&(~3);
-
-	for(count=0;count<len;count++)
-	{
-		spi_transmit(pgm_read_byte_far(data+count));
-	}
-
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-*/
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_memzero(uint32_t ptr, uint32_t num)
-{
-	eve_begin_cmd(CMD_MEMZERO);
-	spi_transmit_32(ptr);
-	spi_transmit_32(num);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command, does not support cmd-burst */
-/* it does not wait for completion in order to allow the video to be paused or terminated by REG_PLAY_CONTROL */
-void EVE_cmd_playvideo(uint32_t options, const uint8_t *data, uint32_t len)
-{
-	eve_begin_cmd(CMD_PLAYVIDEO);
-	spi_transmit_32(options);
-	EVE_cs_clear();
+	/* we have a display with a Goodix GT911 / GT9271 touch-controller on it, so we patch our FT811 or FT813 according to AN_336 or setup a BT815 accordingly */
+	#if defined (EVE_HAS_GT911)
 
 	#if EVE_GEN > 2
-	if( ((options & EVE_OPT_MEDIAFIFO) == 0) && ((options & EVE_OPT_FLASH) == 0) )/* direct data, neither by Media-FIFO or from Flash */
+		EVE_memWrite16(REG_TOUCH_CONFIG, 0x05d0); /* switch to Goodix touch controller */
 	#else
-	if((options & EVE_OPT_MEDIAFIFO) == 0) /* direct data, not by Media-FIFO */
-	#endif
-	{
-		if(data)
-		{
-			block_transfer(data, len);
-		}
-	}
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-/* regvalue = EVE_cmd_regread(ptr); */
-/* this seems to be completely pointless, there is no real use for it outside a display-list since the register could be read directly */
-/* and for what purpose would this be implemented to be used in a display list?? */
-uint32_t EVE_cmd_regread(uint32_t ptr)
-{
-	uint16_t cmdoffset;
-
-	eve_begin_cmd(CMD_REGREAD);
-	spi_transmit_32(ptr);
-	spi_transmit_32(0);
-	EVE_cs_clear();
-	while (EVE_busy());
-	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-	cmdoffset -= 4;
-	cmdoffset &= 0x0fff;
-	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_setrotate(uint32_t r)
-{
-	eve_begin_cmd(CMD_SETROTATE);
-	spi_transmit_32(r);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_snapshot(uint32_t ptr)
-{
-	eve_begin_cmd(CMD_SNAPSHOT);
-	spi_transmit_32(ptr);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_snapshot2(uint32_t fmt, uint32_t ptr, int16_t x0, int16_t y0, int16_t w0, int16_t h0)
-{
-	eve_begin_cmd(CMD_SNAPSHOT2);
-	spi_transmit_32(fmt);
-	spi_transmit_32(ptr);
-
-	spi_transmit((uint8_t)(x0));
-	spi_transmit((uint8_t)(x0 >> 8));
-	spi_transmit((uint8_t)(y0));
-	spi_transmit((uint8_t)(y0 >> 8));
-
-	spi_transmit((uint8_t)(w0));
-	spi_transmit((uint8_t)(w0 >> 8));
-	spi_transmit((uint8_t)(h0));
-	spi_transmit((uint8_t)(h0 >> 8));
-
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_track(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t tag)
-{
-	eve_begin_cmd(CMD_TRACK);
-
-	spi_transmit((uint8_t)(x0));
-	spi_transmit((uint8_t)(x0 >> 8));
-	spi_transmit((uint8_t)(y0));
-	spi_transmit((uint8_t)(y0 >> 8));
-
-	spi_transmit((uint8_t)(w0));
-	spi_transmit((uint8_t)(w0 >> 8));
-	spi_transmit((uint8_t)(h0));
-	spi_transmit((uint8_t)(h0 >> 8));
-
-	spi_transmit((uint8_t)(tag));
-	spi_transmit((uint8_t)(tag >> 8));
-	spi_transmit(0);
-	spi_transmit(0);
-
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
-void EVE_cmd_videoframe(uint32_t dest, uint32_t result_ptr)
-{
-	eve_begin_cmd(CMD_VIDEOFRAME);
-	spi_transmit_32(dest);
-	spi_transmit_32(result_ptr);
-	EVE_cs_clear();
-	while (EVE_busy());
-}
-
-
-/*----------------------------------------------------------------------------------------------------------------------------*/
-/*------------- patching and initialisation ----------------------------------------------------------------------------------*/
-/*----------------------------------------------------------------------------------------------------------------------------*/
-
-#if EVE_GEN > 2
-
-/* switch the FLASH attached to a BT815/BT816 to full-speed mode, returns 0 for failing to do so */
-uint8_t EVE_init_flash(void)
-{
-	uint8_t timeout = 0;
-	uint8_t status;
-
-	status = EVE_memRead8(REG_FLASH_STATUS); /* should be 0x02 - FLASH_STATUS_BASIC, power-up is done and the attached flash is detected */
-
-	while(status == 0) /* FLASH_STATUS_INIT - we are somehow still in init, give it a litte more time, this should never happen */
-	{
-		status = EVE_memRead8(REG_FLASH_STATUS);
-		DELAY_MS(1);
-		timeout++;
-		if(timeout > 100) /* 100ms and still in init, lets call quits now and exit with an error */
-		{
-			return 0;
-		}
-	}
-
-	if(status == 1) /* FLASH_STATUS_DETACHED - no flash was found during init, no flash present or the detection failed, but have hope and let the BT81x have annother try */
-	{
-		EVE_cmd_dl(CMD_FLASHATTACH);
-		while (EVE_busy());
-		status = EVE_memRead8(REG_FLASH_STATUS);
-		if(status != 2) /* still not in FLASH_STATUS_BASIC, time to give up */
-		{
-			return 0;
-		}
-	}
-
-	if(status == 2) /* FLASH_STATUS_BASIC - flash detected and ready for action, lets move it up to FLASH_STATUS_FULL */
-	{
-		uint32_t result;
-
-		result = EVE_cmd_flashfast();
-
-		if(result == 0) /* cmd_flashfast was successful */
-		{
-			return 1;
-		}
-		else /* room for improvement, cmd_flashfast provided an error code but there is no way to return it without returning a value that is FALSE all the same */
-		{
-			return 0;
-		}
-	}
-
-	if(status == 3) /* FLASH_STATUS_FULL - we are already there, why has this function been called? */
-	{
-		return 1;
-	}
+		uint32_t ftAddress;
 
-	return 0;
-}
+		ftAddress = REG_CMDB_WRITE;
 
-#endif /* EVE_GEN > 2 */
-
-
-/* FT811 / FT813 binary-blob from FTDIs AN_336 to patch the touch-engine for Goodix GT911 / GT9271 touch controllers */
-#if defined (EVE_HAS_GT911)
-
-#if	defined (__AVR__)
-#include <avr/pgmspace.h>
-#else
-#define PROGMEM
-#endif
-
-const uint16_t EVE_GT911_len = 1184;
-const uint8_t EVE_GT911_data[1184] PROGMEM =
-{
-	26,255,255,255,32,32,48,0,4,0,0,0,2,0,0,0,
-	34,255,255,255,0,176,48,0,120,218,237,84,221,111,84,69,20,63,51,179,93,160,148,101,111,76,5,44,141,123,111,161,11,219,154,16,9,16,17,229,156,75,26,11,13,21,227,3,16,252,184,179,
-	45,219,143,45,41,125,144,72,67,100,150,71,189,113,18,36,17,165,100,165,198,16,32,17,149,196,240,128,161,16,164,38,54,240,0,209,72,130,15,38,125,48,66,82,30,76,19,31,172,103,46,
-	139,24,255,4,227,157,204,156,51,115,102,206,231,239,220,5,170,94,129,137,75,194,216,98,94,103,117,115,121,76,131,177,125,89,125,82,123,60,243,58,142,242,204,185,243,188,118,156,
-	227,155,203,238,238,195,251,205,229,71,92,28,169,190,184,84,143,113,137,53,244,103,181,237,87,253,113,137,233,48,12,198,165,181,104,139,25,84,253,155,114,74,191,0,54,138,163,
-	12,62,131,207,129,23,217,34,91,31,128,65,246,163,175,213,8,147,213,107,35,203,94,108,3,111,40,171,83,24,15,165,177,222,116,97,23,188,140,206,150,42,102,181,87,78,86,182,170,134,
-	215,241,121,26,243,252,2,76,115,217,139,222,206,173,136,132,81,61,35,185,39,113,23,46,199,76,178,54,151,183,224,0,40,189,28,149,182,58,131,79,152,30,76,34,98,234,162,216,133,141,
-	102,39,170,40,192,101,53,201,146,191,37,77,44,177,209,74,211,5,206,187,5,6,216,47,53,96,123,22,50,103,251,192,84,17,74,227,185,56,106,51,91,161,96,182,163,48,171,141,139,65,152,
-	66,66,11,102,43,158,75,36,80,147,184,147,139,112,17,235,216,103,111,239,245,92,10,175,194,40,44,58,125,5,59,112,50,103,245,4,78,192,5,156,194,51,60,191,134,75,110,173,237,46,192,
-	121,156,192,115,184,218,120,67,63,115,46,11,102,10,97,232,50,235,114,182,148,118,178,41,188,12,135,77,202,124,12,96,238,35,161,234,189,129,23,249,212,139,230,25,53,48,205,52,93,
-	163,117,53,154,170,81,85,163,178,70,69,66,167,241,14,46,241,1,226,136,152,179,197,59,184,148,254,49,132,48,15,176,137,192,76,131,196,105,104,162,86,81,160,165,255,26,173,162,137,
-	86,145,210,183,192,55,175,194,211,60,91,120,230,184,174,27,41,131,155,40,224,29,87,179,232,16,55,55,7,165,147,81,23,165,49,101,54,224,75,180,81,108,18,29,226,69,225,110,175,224,
-	42,212,25,47,130,193,110,234,192,215,252,56,74,162,24,46,251,174,54,106,68,245,14,9,155,160,22,120,207,104,240,29,90,178,140,28,24,220,47,166,112,61,251,208,192,111,56,239,238,
-	93,255,251,62,99,32,193,75,61,190,235,123,229,110,218,194,85,79,225,59,98,20,238,227,235,220,11,221,149,25,180,116,194,159,111,96,192,24,213,59,139,179,156,215,69,230,19,24,35,
-	135,117,206,171,206,162,67,129,234,61,235,11,104,103,84,64,223,167,254,40,163,101,92,84,43,150,46,249,219,205,7,116,11,91,104,61,57,75,223,8,48,25,28,119,252,222,113,49,86,249,
-	74,180,211,156,181,61,215,168,157,7,251,199,150,242,250,91,58,132,94,121,7,53,151,139,98,6,165,153,69,214,32,110,211,100,101,31,89,45,81,98,23,205,205,197,209,109,186,198,35,
-	141,191,249,25,60,132,223,153,251,98,20,239,146,139,20,217,250,41,250,137,58,177,90,57,79,51,108,233,20,253,194,187,49,222,205,114,141,96,48,175,219,107,54,111,138,22,154,103,
-	108,79,58,252,179,178,79,164,195,2,153,36,39,170,199,201,167,197,85,106,8,59,177,81,46,56,2,230,75,114,17,55,112,188,65,208,137,77,114,10,115,55,58,208,197,173,122,87,6,140,
-	110,42,208,124,163,70,108,241,104,18,245,98,214,187,134,53,42,221,22,182,133,211,116,148,177,194,209,192,85,90,199,58,55,203,2,229,19,137,187,161,228,154,112,203,145,125,244,
-	188,220,118,228,41,201,181,41,195,144,215,183,51,80,250,21,217,16,217,200,235,109,227,188,122,218,142,60,170,224,112,240,184,130,229,224,113,5,223,148,163,80,165,183,130,187,
-	132,116,64,238,161,85,220,115,139,205,98,227,244,29,102,125,7,37,243,123,223,11,26,92,63,243,116,61,191,138,123,244,160,84,186,74,31,5,174,247,119,135,199,248,253,135,242,97,
-	102,145,190,144,14,85,238,221,231,193,158,48,205,25,120,248,15,220,29,158,9,70,185,30,103,229,33,254,23,237,160,172,62,193,90,222,224,232,14,200,56,90,104,142,227,120,110,6,
-	21,211,203,65,150,99,151,220,247,87,164,50,159,49,239,234,58,142,0,109,108,123,18,79,227,36,100,248,222,205,96,127,120,26,171,228,69,63,36,17,252,200,17,116,242,187,227,88,143,
-	247,2,75,191,6,130,59,188,11,55,240,31,243,122,152,226,183,207,154,73,188,39,219,43,105,222,87,41,143,141,140,175,73,112,184,252,61,184,16,90,250,35,168,82,119,176,57,116,94,
-	200,150,22,190,179,44,104,12,235,84,149,102,252,89,154,193,99,228,106,242,125,248,64,194,255,223,127,242,83,11,255,2,70,214,226,128,0,0
-};
-#endif
-
-
-/* init, has to be executed with the SPI setup to 11 MHz or less as required by FT8xx / BT8xx */
-uint8_t EVE_init(void)
-{
-	uint8_t chipid = 0;
-	uint16_t timeout = 0;
-
-	EVE_pdn_set();
-	DELAY_MS(6); /* minimum time for power-down is 5ms */
-	EVE_pdn_clear();
-	DELAY_MS(21); /* minimum time to allow from rising PD_N to first access is 20ms */
-
-/*	EVE_cmdWrite(EVE_CORERST,0); */ /* reset, only required for warm-start if PowerDown line is not used */
-
-	#if defined (EVE_HAS_CRYSTAL)
-	EVE_cmdWrite(EVE_CLKEXT,0);	/* setup EVE for external clock */
-	#else
-	EVE_cmdWrite(EVE_CLKINT,0);	/* setup EVE for internal clock */
-	#endif
-
-	#if EVE_GEN > 2
-	EVE_cmdWrite(EVE_CLKSEL,0x46); /* set clock to 72 MHz */
-	#endif
-
-	EVE_cmdWrite(EVE_ACTIVE,0);	/* start EVE */
-
-	/*
-	BRT AN033 BT81X_Series_Programming_Guide V1.2 added a delay of at least 300ms as a requirement after sending command ACTIVE.
-	Together with the sentence: "Ensure that there is no SPI access during this time."
-	AN033 BT81X_Series_Programming_Guide V2.0 removed this delay requirement again.
-	From observation of the startup-behavior of quite a number of displays, reading REG_ID immediately after
-	sending command ACTIVE is not an issue, but a BT815 running at 72MHzs needs about 42ms before it answers anyways. 
-	So I added a fixed delay of 40ms as a compromise, this provides a moment of silence on the SPI
-	without actually delaying the startup.
-	*/
-	DELAY_MS(40);
-
-	while(chipid != 0x7C) /* if chipid is not 0x7c, continue to read it until it is, EVE needs a moment for its power on self-test and configuration */
-	{
-		DELAY_MS(1);
-		chipid = EVE_memRead8(REG_ID);
-		timeout++;
-		if(timeout > 400)
-		{
-			return 0;
-		}
-	}
-
-	timeout = 0;
-	while (0x00 != (EVE_memRead8(REG_CPURESET) & 0x07)) /* check if EVE is in working status */
-	{
-		DELAY_MS(1);
-		timeout++;
-		if(timeout > 50) /* experimental, 10 was the lowest value to get the BT815 started with, the touch-controller was the last to get out of reset */
-		{
-			return 0;
-		}
-	}
-
-	/* tell EVE that we changed the frequency from default to 72MHz for BT8xx */
-	#if EVE_GEN > 2
-	EVE_memWrite32(REG_FREQUENCY, 72000000);
-	#endif
-
-	/* we have a display with a Goodix GT911 / GT9271 touch-controller on it, so we patch our FT811 or FT813 according to AN_336 or setup a BT815 accordingly */
-	#if defined (EVE_HAS_GT911)
-
-	#if EVE_GEN > 2
-		EVE_memWrite16(REG_TOUCH_CONFIG, 0x05d0); /* switch to Goodix touch controller */
-	#else
-		uint32_t ftAddress;
-
-		ftAddress = REG_CMDB_WRITE;
-
-		EVE_cs_set();
-		spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
-		spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
-		spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
-		private_block_write(EVE_GT911_data, EVE_GT911_len);
-		EVE_cs_clear();
-		while (EVE_busy());
-
-		EVE_memWrite8(REG_TOUCH_OVERSAMPLE, 0x0f); /* setup oversample to 0x0f as "hidden" in binary-blob for AN_336 */
-		EVE_memWrite16(REG_TOUCH_CONFIG, 0x05D0); /* write magic cookie as requested by AN_336 */
-
-		/* specific to the EVE2 modules from Matrix-Orbital we have to use GPIO3 to reset GT911 */
-		EVE_memWrite16(REG_GPIOX_DIR,0x8008); /* Reset-Value is 0x8000, adding 0x08 sets GPIO3 to output, default-value for REG_GPIOX is 0x8000 -> Low output on GPIO3 */
-		DELAY_MS(1); /* wait more than 100�s */
-		EVE_memWrite8(REG_CPURESET, 0x00); /* clear all resets */
-		DELAY_MS(110); /* wait more than 55ms - does not work with multitouch, for some reason a minimum delay of 108ms is required */
-		EVE_memWrite16(REG_GPIOX_DIR,0x8000); /* setting GPIO3 back to input */
-	#endif
-	#endif
-
-	/*	EVE_memWrite8(REG_PCLK, 0x00);	*/	/* set PCLK to zero - don't clock the LCD until later, line disabled because zero is reset-default and we just did a reset */
-
-	#if defined (EVE_ADAM101)
-	EVE_memWrite8(REG_PWM_DUTY, 0x80); /* turn off backlight for Glyn ADAM101 module, it uses inverted values */
-	#else
-	EVE_memWrite8(REG_PWM_DUTY, 0); /* turn off backlight for any other module */
-	#endif
-
-	/* Initialize Display */
-	EVE_memWrite16(REG_HSIZE,   EVE_HSIZE);   /* active display width */
-	EVE_memWrite16(REG_HCYCLE,  EVE_HCYCLE);  /* total number of clocks per line, incl front/back porch */
-	EVE_memWrite16(REG_HOFFSET, EVE_HOFFSET); /* start of active line */
-	EVE_memWrite16(REG_HSYNC0,  EVE_HSYNC0);  /* start of horizontal sync pulse */
-	EVE_memWrite16(REG_HSYNC1,  EVE_HSYNC1);  /* end of horizontal sync pulse */
-	EVE_memWrite16(REG_VSIZE,   EVE_VSIZE);   /* active display height */
-	EVE_memWrite16(REG_VCYCLE,  EVE_VCYCLE);  /* total number of lines per screen, including pre/post */
-	EVE_memWrite16(REG_VOFFSET, EVE_VOFFSET); /* start of active screen */
-	EVE_memWrite16(REG_VSYNC0,  EVE_VSYNC0);  /* start of vertical sync pulse */
-	EVE_memWrite16(REG_VSYNC1,  EVE_VSYNC1);  /* end of vertical sync pulse */
-	EVE_memWrite8(REG_SWIZZLE,  EVE_SWIZZLE); /* FT8xx output to LCD - pin order */
-	EVE_memWrite8(REG_PCLK_POL, EVE_PCLKPOL); /* LCD data is clocked in on this PCLK edge */
-	EVE_memWrite8(REG_CSPREAD,	EVE_CSPREAD); /* helps with noise, when set to 1 fewer signals are changed simultaneously, reset-default: 1 */
-
-	/* do not set PCLK yet - wait for just after the first display list */
-
-	/* configure Touch */
-	EVE_memWrite8(REG_TOUCH_MODE, EVE_TMODE_CONTINUOUS); /* enable touch */
-	EVE_memWrite16(REG_TOUCH_RZTHRESH, EVE_TOUCH_RZTHRESH);	/* eliminate any false touches */
-
-	/* disable Audio for now */
-	EVE_memWrite8(REG_VOL_PB, 0x00); /* turn recorded audio volume down */
-	EVE_memWrite8(REG_VOL_SOUND, 0x00); /* turn synthesizer volume off */
-	EVE_memWrite16(REG_SOUND, 0x6000); /* set synthesizer to mute */
-
-	/* write a basic display-list to get things started */
-	EVE_memWrite32(EVE_RAM_DL, DL_CLEAR_RGB);
-	EVE_memWrite32(EVE_RAM_DL + 4, (DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG));
-	EVE_memWrite32(EVE_RAM_DL + 8, DL_DISPLAY);	/* end of display list */
-	EVE_memWrite32(REG_DLSWAP, EVE_DLSWAP_FRAME);
-
-	/* nothing is being displayed yet... the pixel clock is still 0x00 */
-
-	#if EVE_GEN > 3
-	#if defined (EVE_PCLK_FREQ)
-	uint32_t frequency;
-	frequency = EVE_cmd_pclkfreq(EVE_PCLK_FREQ, 0); /* setup the second PLL for the pixel-clock according to the define in EVE_config.h for the display, as close a match as possible */
-	if(frequency == 0) /* this failed for some reason so we return with an error */
-	{
-		return 0;
-	}
-	#endif
-	#endif
-
-	EVE_memWrite8(REG_GPIO, 0x80); /* enable the DISP signal to the LCD panel, it is set to output in REG_GPIO_DIR by default */
-	EVE_memWrite8(REG_PCLK, EVE_PCLK); /* now start clocking data to the LCD panel */
-
-	#if defined (EVE_ADAM101)
-	EVE_memWrite8(REG_PWM_DUTY, 0x60); /* turn on backlight to 25% for Glyn ADAM101 module, it uses inverted values */
-	#else
-	EVE_memWrite8(REG_PWM_DUTY, 0x20); /* turn on backlight to 25% for any other module */
-	#endif
-
-	timeout = 0;
-	while(EVE_busy() == 1) /* just to be safe, should not even enter the loop */
-	{
-		DELAY_MS(1);
-		timeout++;
-		if(timeout > 4)
-		{
-			break; /* something is wrong here, but since we made it this far through the init, just leave the loop */
-		}
-	}
-
-	#if defined (EVE_DMA)
-	EVE_init_dma(); /* prepare DMA */
-	#endif
-
-	return 1;
-}
-
-
-/*----------------------------------------------------------------------------------------------------------------------------*/
-/*-------- functions for display lists ---------------------------------------------------------------------------------------*/
-/*----------------------------------------------------------------------------------------------------------------------------*/
-
-/*
-These eliminate the overhead of transmitting the command-fifo address with every single command, just wrap a sequence of commands
-with these and the address is only transmitted once at the start of the block.
-Be careful to not use any functions in the sequence that do not address the command-fifo as for example any EVE_mem...() function.
-*/
-void EVE_start_cmd_burst(void)
-{
-	uint32_t ftAddress;
-
-#if defined (EVE_DMA)
-	if(EVE_dma_busy)
-	{
-		while (EVE_busy()); /* this is a safe-guard to protect segmented display-list building with DMA from overlapping */
-	}
-#endif
-
-	cmd_burst = 42;
-	ftAddress = REG_CMDB_WRITE;
-
-	#if defined (EVE_DMA)
-		/* 0x low mid hi 00 */
-		EVE_dma_buffer[0] = ((uint8_t)(ftAddress >> 16) | MEM_WRITE) | (ftAddress & 0x0000ff00) |  ((uint8_t)(ftAddress) << 16);
-		EVE_dma_buffer[0] = EVE_dma_buffer[0] << 8;
-		EVE_dma_buffer_index = 1;
-	#else
 		EVE_cs_set();
 		spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
 		spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
 		spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
-	#endif
-}
-
-
-void EVE_end_cmd_burst(void)
-{
-	cmd_burst = 0;
-
-	#if defined (EVE_DMA)
-		EVE_start_dma_transfer(); /* begin DMA transfer */
-	#else
-		EVE_cs_clear();
-	#endif
-}
-
-#if 0
-/* private function, begin a co-processor command, only used for non-burst commands */
-static void EVE_start_command(uint32_t command)
-{
-	uint32_t ftAddress;
-
-	ftAddress = REG_CMDB_WRITE;
-	EVE_cs_set();
-	spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
-	spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
-	spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
-
-	spi_transmit_32(command);
-}
-#endif
-
-/* write a string to co-processor memory in context of a command: no chip-select, just plain SPI-transfers */
-static void private_string_write(const char *text)
-{
-	uint8_t textindex = 0;
-	uint8_t padding = 0;
-	uint8_t *bytes = (uint8_t *) text; /* treat the array as bunch of bytes */
-
-	if(cmd_burst)
-	{
-		uint32_t calc;
-		uint8_t data;
-
-		for(textindex = 0; textindex < 249;)
-		{
-			calc = 0;
-
-			data = bytes[textindex++];
-			if(data == 0)
-			{
-				spi_transmit_burst(calc);
-				break;
-			}
-			calc += (uint32_t) (data);
-
-			data = bytes[textindex++];
-			if(data == 0)
-			{
-				spi_transmit_burst(calc);
-				break;
-			}
-			calc += ((uint32_t) data) << 8;
-
-			data = bytes[textindex++];
-			if(data == 0)
-			{
-				spi_transmit_burst(calc);
-				break;
-			}
-			calc += ((uint32_t) data) << 16;
-
-			data = bytes[textindex++];
-			if(data == 0)
-			{
-				spi_transmit_burst(calc);
-				break;
-			}
-			calc += ((uint32_t) data) << 24;
-
-			spi_transmit_burst(calc);
-		}
-	}
-	else
-	{
-		while(bytes[textindex] != 0)
-		{
-			spi_transmit(bytes[textindex]);
-			textindex++;
-			if(textindex > 249) /* there appears to be no end for the "string", so leave */
-			{
-				break;
-			}
-		}
-
-		/* we need to transmit at least one 0x00 byte and up to four if the string happens to be 4-byte aligned already */
-		padding = textindex & 3;  /* 0, 1, 2 or 3 */
-		padding = 4-padding; /* 4, 3, 2 or 1 */
-		textindex += padding;
-
-		while(padding > 0)
-		{
-			spi_transmit(0);
-			padding--;
-		}
-	}
-}
-
-
-
-/* BT817 / BT818 */
-#if EVE_GEN > 3
-
-void EVE_cmd_animframeram(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMFRAMERAM);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit_32(aoptr);
-		spi_transmit_32(frame);
-
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animframeram_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
-{
-	spi_transmit_burst(CMD_ANIMFRAMERAM);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst(aoptr);
-	spi_transmit_burst(frame);
-}
-
-
-void EVE_cmd_animstartram(int32_t ch, uint32_t aoptr, uint32_t loop)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMSTARTRAM);
-		spi_transmit_32(ch);
-		spi_transmit_32(aoptr);
-		spi_transmit_32(loop);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animstartram_burst(int32_t ch, uint32_t aoptr, uint32_t loop)
-{
-	spi_transmit_burst(CMD_ANIMSTARTRAM);
-	spi_transmit_burst(ch);
-	spi_transmit_burst(aoptr);
-	spi_transmit_burst(loop);
-}
-
-
-void EVE_cmd_apilevel(uint32_t level)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_APILEVEL);
-		spi_transmit_32(level);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_apilevel_burst(uint32_t level)
-{
-	spi_transmit_burst(CMD_APILEVEL);
-	spi_transmit_burst(level);
-}
-
-
-void EVE_cmd_calibratesub(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_CALIBRATESUB);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(width));
-		spi_transmit((uint8_t)(width >> 8));
-		spi_transmit((uint8_t)(height));
-		spi_transmit((uint8_t)(height >> 8));
-
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_calllist(uint32_t adr)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_CALLLIST);
-		spi_transmit_32(adr);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_calllist_burst(uint32_t adr)
-{
-	spi_transmit_burst(CMD_CALLLIST);
-	spi_transmit_burst(adr);
-}
-
-
-void EVE_cmd_hsf(uint32_t hsf)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_HSF);
-		spi_transmit_32(hsf);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_hsf_burst(uint32_t hsf)
-{
-	spi_transmit_burst(CMD_HSF);
-	spi_transmit_burst(hsf);
-}
-
-
-void EVE_cmd_runanim(uint32_t waitmask, uint32_t play)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_RUNANIM);
-		spi_transmit_32(waitmask);
-		spi_transmit_32(play);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_runanim_burst(uint32_t waitmask, uint32_t play)
-{
-	spi_transmit_burst(CMD_RUNANIM);
-	spi_transmit_burst(waitmask);
-	spi_transmit_burst(play);
-}
-
-
-#endif /* EVE_GEN > 3 */
-
-
-/* BT815 / BT816 */
-#if EVE_GEN > 2
-
-void EVE_cmd_animdraw(int32_t ch)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMDRAW);
-		spi_transmit_32(ch);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animdraw_burst(int32_t ch)
-{
-	spi_transmit_burst(CMD_ANIMDRAW);
-	spi_transmit_burst(ch);
-}
-
-
-void EVE_cmd_animframe(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMFRAME);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit_32(aoptr);
-		spi_transmit_32(frame);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animframe_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
-{
-	spi_transmit_burst(CMD_ANIMFRAME);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst(aoptr);
-	spi_transmit_burst(frame);
-}
-
-
-void EVE_cmd_animstart(int32_t ch, uint32_t aoptr, uint32_t loop)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMSTART);
-
-		spi_transmit_32(ch);
-		spi_transmit_32(aoptr);
-		spi_transmit_32(loop);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animstart_burst(int32_t ch, uint32_t aoptr, uint32_t loop)
-{
-	spi_transmit_burst(CMD_ANIMSTART);
-	spi_transmit_burst(ch);
-	spi_transmit_burst(aoptr);
-	spi_transmit_burst(loop);
-}
-
-
-void EVE_cmd_animstop(int32_t ch)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMSTOP);
-		spi_transmit_32(ch);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animstop_burst(int32_t ch)
-{
-	spi_transmit_burst(CMD_ANIMSTOP);
-	spi_transmit_burst(ch);
-}
-
-
-void EVE_cmd_animxy(int32_t ch, int16_t x0, int16_t y0)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ANIMXY);
-		spi_transmit_32(ch);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_animxy_burst(int32_t ch, int16_t x0, int16_t y0)
-{
-	spi_transmit_burst(CMD_ANIMXY);
-	spi_transmit_burst(ch);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-}
-
-
-void EVE_cmd_appendf(uint32_t ptr, uint32_t num)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_APPENDF);
-		spi_transmit_32(ptr);
-		spi_transmit_32(num);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_appendf_burst(uint32_t ptr, uint32_t num)
-{
-	spi_transmit_burst(CMD_APPENDF);
-	spi_transmit_burst(ptr);
-	spi_transmit_burst(num);
-}
-
-
-
-uint16_t EVE_cmd_bitmap_transform(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2)
-{
-	if(!cmd_burst)
-	{
-		uint16_t cmdoffset;
-
-		eve_begin_cmd(CMD_BITMAP_TRANSFORM);
-		spi_transmit_32(x0);
-		spi_transmit_32(y0);
-		spi_transmit_32(x1);
-		spi_transmit_32(y1);
-		spi_transmit_32(x2);
-		spi_transmit_32(y2);
-		spi_transmit_32(tx0);
-		spi_transmit_32(ty0);
-		spi_transmit_32(tx1);
-		spi_transmit_32(ty1);
-		spi_transmit_32(tx2);
-		spi_transmit_32(ty2);
-		spi_transmit_32(0);
-		EVE_cs_clear();
-		while (EVE_busy());
-		cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-		cmdoffset -= 4;
-		cmdoffset &= 0x0fff;
-		return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
-	}
-	return 0;
-}
-
-
-/* note: as this is meant for use in burst-mode display-list generation the result parameter is ignored */
-void EVE_cmd_bitmap_transform_burst( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2)
-{
-	spi_transmit_burst(CMD_BITMAP_TRANSFORM);
-	spi_transmit_burst(x0);
-	spi_transmit_burst(y0);
-	spi_transmit_burst(x1);
-	spi_transmit_burst(y1);
-	spi_transmit_burst(x2);
-	spi_transmit_burst(y2);
-	spi_transmit_burst(tx0);
-	spi_transmit_burst(ty0);
-	spi_transmit_burst(tx1);
-	spi_transmit_burst(ty1);
-	spi_transmit_burst(tx2);
-	spi_transmit_burst(ty2);
-	spi_transmit_burst(0);
-}
-
-
-void EVE_cmd_fillwidth(uint32_t s)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_FILLWIDTH);
-		spi_transmit_32(s);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_fillwidth_burst(uint32_t s)
-{
-	spi_transmit_burst(CMD_FILLWIDTH);
-	spi_transmit_burst(s);
-}
-
-
-void EVE_cmd_gradienta(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_GRADIENTA);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit_32(argb0);
-
-		spi_transmit((uint8_t)(x1));
-		spi_transmit((uint8_t)(x1 >> 8));
-		spi_transmit((uint8_t)(y1));
-		spi_transmit((uint8_t)(y1 >> 8));
-
-		spi_transmit_32(argb1);
-
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_gradienta_burst(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1)
-{
-	spi_transmit_burst(CMD_GRADIENTA);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst(argb0);
-	spi_transmit_burst((uint32_t) x1 + ((uint32_t) y1 << 16));
-	spi_transmit_burst(argb1);
-}
-
-
-void EVE_cmd_rotatearound(int32_t x0, int32_t y0, int32_t angle, int32_t scale)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_ROTATEAROUND);
-		spi_transmit_32(x0);
-		spi_transmit_32(y0);
-		spi_transmit_32(angle);
-		spi_transmit_32(scale);
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_rotatearound_burst(int32_t x0, int32_t y0, int32_t angle, int32_t scale)
-{
-	spi_transmit_burst(CMD_ROTATEAROUND);
-	spi_transmit_burst(x0);
-	spi_transmit_burst(y0);
-	spi_transmit_burst(angle);
-	spi_transmit_burst(scale);
-}
-
-
-/* as the name implies, "num_args" is the number of arguments passed to this function as variadic arguments */
-void EVE_cmd_button_var(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_BUTTON);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
-
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-
-		private_string_write(text);
-
-		if(options & EVE_OPT_FORMAT)
-		{
-			va_list arguments;
-			uint8_t counter;
-			uint32_t data;
-
-			va_start(arguments, num_args);
-
-			for(counter=0;counter<num_args;counter++)
-			{
-				data = (uint32_t) va_arg(arguments, int);
-				spi_transmit_32(data);
-			}
-
-			va_end(arguments);
-		}
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_button_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
-{
-	spi_transmit_burst(CMD_BUTTON);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
-	private_string_write(text);
-
-	if(options & EVE_OPT_FORMAT)
-	{
-		va_list arguments;
-		uint8_t counter;
-
-		va_start(arguments, num_args);
-
-		for(counter=0;counter<num_args;counter++)
-		{
-			spi_transmit_burst((uint32_t) va_arg(arguments, int));
-		}
-		va_end(arguments);
-	}
-}
-
-
-/* as the name implies, "num_args" is the number of arguments passed to this function as variadic arguments */
-void EVE_cmd_text_var(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_TEXT);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-
-		private_string_write(text);
-
-		if(options & EVE_OPT_FORMAT)
-		{
-			va_list arguments;
-			uint8_t counter;
-			uint32_t data;
-
-			va_start(arguments, num_args);
-
-			for(counter=0;counter<num_args;counter++)
-			{
-				data = (uint32_t) va_arg(arguments, int);
-				spi_transmit_32(data);
-			}
-			va_end(arguments);
-		}
-		EVE_cs_clear();
-	}
-}
-
-
-void EVE_cmd_text_var_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
-{
-	spi_transmit_burst(CMD_TEXT);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
-	private_string_write(text);
-
-	#if EVE_GEN > 2
-	if(options & EVE_OPT_FORMAT)
-	{
-		va_list arguments;
-		uint8_t counter;
+		private_block_write(EVE_GT911_data, EVE_GT911_len);
+		EVE_cs_clear();
+		while (EVE_busy());
 
-		va_start(arguments, num_args);
+		EVE_memWrite8(REG_TOUCH_OVERSAMPLE, 0x0f); /* setup oversample to 0x0f as "hidden" in binary-blob for AN_336 */
+		EVE_memWrite16(REG_TOUCH_CONFIG, 0x05D0); /* write magic cookie as requested by AN_336 */
 
-		for(counter=0;counter<num_args;counter++)
-		{
-			spi_transmit_burst((uint32_t) va_arg(arguments, int));
-		}
-		va_end(arguments);
-	}
+		/* specific to the EVE2 modules from Matrix-Orbital we have to use GPIO3 to reset GT911 */
+		EVE_memWrite16(REG_GPIOX_DIR,0x8008); /* Reset-Value is 0x8000, adding 0x08 sets GPIO3 to output, default-value for REG_GPIOX is 0x8000 -> Low output on GPIO3 */
+		DELAY_MS(1); /* wait more than 100�s */
+		EVE_memWrite8(REG_CPURESET, 0x00); /* clear all resets */
+		DELAY_MS(110); /* wait more than 55ms - does not work with multitouch, for some reason a minimum delay of 108ms is required */
+		EVE_memWrite16(REG_GPIOX_DIR,0x8000); /* setting GPIO3 back to input */
+	#endif
 	#endif
 }
 
 
-/* as the name implies, "num_args" is the number of arguments passed to this function as variadic arguments */
-void EVE_cmd_toggle_var(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...)
+static void eve_init_timing(void)
 {
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_TOGGLE);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
+	/*	EVE_memWrite8(REG_PCLK, 0x00);	*/	/* set PCLK to zero - don't clock the LCD until later, line disabled because zero is reset-default and we just did a reset */
 
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-		spi_transmit((uint8_t)(state));
-		spi_transmit((uint8_t)(state >> 8));
+	#if defined (EVE_ADAM101)
+	EVE_memWrite8(REG_PWM_DUTY, 0x80); /* turn off backlight for Glyn ADAM101 module, it uses inverted values */
+	#else
+	EVE_memWrite8(REG_PWM_DUTY, 0); /* turn off backlight for any other module */
+	#endif
 
-		private_string_write(text);
+	/* Initialize Display */
+	EVE_memWrite16(REG_HSIZE,   EVE_HSIZE);   /* active display width */
+	EVE_memWrite16(REG_HCYCLE,  EVE_HCYCLE);  /* total number of clocks per line, incl front/back porch */
+	EVE_memWrite16(REG_HOFFSET, EVE_HOFFSET); /* start of active line */
+	EVE_memWrite16(REG_HSYNC0,  EVE_HSYNC0);  /* start of horizontal sync pulse */
+	EVE_memWrite16(REG_HSYNC1,  EVE_HSYNC1);  /* end of horizontal sync pulse */
+	EVE_memWrite16(REG_VSIZE,   EVE_VSIZE);   /* active display height */
+	EVE_memWrite16(REG_VCYCLE,  EVE_VCYCLE);  /* total number of lines per screen, including pre/post */
+	EVE_memWrite16(REG_VOFFSET, EVE_VOFFSET); /* start of active screen */
+	EVE_memWrite16(REG_VSYNC0,  EVE_VSYNC0);  /* start of vertical sync pulse */
+	EVE_memWrite16(REG_VSYNC1,  EVE_VSYNC1);  /* end of vertical sync pulse */
+	EVE_memWrite8(REG_SWIZZLE,  EVE_SWIZZLE); /* FT8xx output to LCD - pin order */
+	EVE_memWrite8(REG_PCLK_POL, EVE_PCLKPOL); /* LCD data is clocked in on this PCLK edge */
+	EVE_memWrite8(REG_CSPREAD,	EVE_CSPREAD); /* helps with noise, when set to 1 fewer signals are changed simultaneously, reset-default: 1 */
 
-		if(options & EVE_OPT_FORMAT)
-		{
-			va_list arguments;
-			uint8_t counter;
-			uint32_t data;
+	/* do not set PCLK yet - wait for just after the first display list */
+}
 
-			va_start(arguments, num_args);
 
-			for(counter=0;counter<num_args;counter++)
-			{
-				data = (uint32_t) va_arg(arguments, int);
-				spi_transmit_32(data);
-			}
+static void eve_init_touch_audio(void)
+{
+	/* configure Touch */
+	EVE_memWrite8(REG_TOUCH_MODE, EVE_TMODE_CONTINUOUS); /* enable touch */
+	EVE_memWrite16(REG_TOUCH_RZTHRESH, EVE_TOUCH_RZTHRESH);	/* eliminate any false touches */
 
-			va_end(arguments);
-		}
-		EVE_cs_clear();
-	}
+	/* disable Audio for now */
+	EVE_memWrite8(REG_VOL_PB, 0x00); /* turn recorded audio volume down */
+	EVE_memWrite8(REG_VOL_SOUND, 0x00); /* turn synthesizer volume off */
+	EVE_memWrite16(REG_SOUND, 0x6000); /* set synthesizer to mute */
 }
 
 
-void EVE_cmd_toggle_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...)
+/* write the first display-list and start the pixel clock, without a list a basic display-list is used */
+static uint8_t eve_init_display(const uint32_t *list, uint16_t words)
 {
-	spi_transmit_burst(CMD_TOGGLE);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) font << 16));
-	spi_transmit_burst((uint32_t) options + ((uint32_t) state << 16));
-	private_string_write(text);
-
-	if(options & EVE_OPT_FORMAT)
+	if(list == 0)
 	{
-		va_list arguments;
-		uint8_t counter;
-
-		va_start(arguments, num_args);
+		/* write a basic display-list to get things started */
+		EVE_memWrite32(EVE_RAM_DL, DL_CLEAR_RGB);
+		EVE_memWrite32(EVE_RAM_DL + 4, (DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG));
+		EVE_memWrite32(EVE_RAM_DL + 8, DL_DISPLAY);	/* end of display list */
+	}
+	else
+	{
+		uint32_t ftAddress = EVE_RAM_DL;
 
-		for(counter=0;counter<num_args;counter++)
+		EVE_cs_set();
+		spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
+		spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
+		spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
+		while(words > 0)
 		{
-			spi_transmit_burst((uint32_t) va_arg(arguments, int));
+			spi_transmit_32(*list++);
+			words--;
 		}
-
-		va_end(arguments);
+		EVE_cs_clear();
 	}
-}
-
-#endif /* EVE_GEN > 2 */
-
+	EVE_memWrite32(REG_DLSWAP, EVE_DLSWAP_FRAME);
 
+	/* nothing is being displayed yet... the pixel clock is still 0x00 */
 
-/* generic function for all commands that have no arguments and all display-list specific control words */
-/*
- examples:
- EVE_cmd_dl(CMD_DLSTART);
- EVE_cmd_dl(CMD_SWAP);
- EVE_cmd_dl(CMD_SCREENSAVER);
- EVE_cmd_dl(LINE_WIDTH(1*16));
- EVE_cmd_dl(VERTEX2F(0,0));
- EVE_cmd_dl(DL_BEGIN | EVE_RECTS);
-*/
-void EVE_cmd_dl(uint32_t command)
-{
-	if(!cmd_burst)
+	#if EVE_GEN > 3
+	#if defined (EVE_PCLK_FREQ)
+	uint32_t frequency;
+	frequency = EVE_cmd_pclkfreq(EVE_PCLK_FREQ, 0); /* setup the second PLL for the pixel-clock according to the define in EVE_config.h for the display, as close a match as possible */
+	if(frequency == 0) /* this failed for some reason so we return with an error */
 	{
-		eve_begin_cmd(command);
-		EVE_cs_clear();
+		return 0;
 	}
-}
-
+	#endif
+	#endif
 
-void EVE_cmd_dl_burst(uint32_t command)
-{
-	spi_transmit_burst(command);
-}
+	EVE_memWrite8(REG_GPIO, 0x80); /* enable the DISP signal to the LCD panel, it is set to output in REG_GPIO_DIR by default */
+	EVE_memWrite8(REG_PCLK, EVE_PCLK); /* now start clocking data to the LCD panel */
+	eve_first_pixel = EVE_memRead32(REG_CLOCK);
 
+	#if defined (EVE_ADAM101)
+	EVE_memWrite8(REG_PWM_DUTY, 0x60); /* turn on backlight to 25% for Glyn ADAM101 module, it uses inverted values */
+	#else
+	EVE_memWrite8(REG_PWM_DUTY, 0x20); /* turn on backlight to 25% for any other module */
+	#endif
 
-void EVE_cmd_append(uint32_t ptr, uint32_t num)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_APPEND);
-		spi_transmit_32(ptr);
-		spi_transmit_32(num);
-		EVE_cs_clear();
-	}
+	return 1;
 }
 
 
-void EVE_cmd_append_burst(uint32_t ptr, uint32_t num)
+static void eve_init_end(void)
 {
-	spi_transmit_burst(CMD_APPEND);
-	spi_transmit_burst(ptr);
-	spi_transmit_burst(num);
-}
-
+	uint16_t timeout = 0;
 
-void EVE_cmd_bgcolor(uint32_t color)
-{
-	if(!cmd_burst)
+	while(EVE_busy() == 1) /* just to be safe, should not even enter the loop */
 	{
-		eve_begin_cmd(CMD_BGCOLOR);
-		spi_transmit((uint8_t)(color));
-		spi_transmit((uint8_t)(color >> 8));
-		spi_transmit((uint8_t)(color >> 16));
-		spi_transmit(0x00);
-		EVE_cs_clear();
+		DELAY_MS(1);
+		timeout++;
+		if(timeout > 4)
+		{
+			break; /* something is wrong here, but since we made it this far through the init, just leave the loop */
+		}
 	}
-}
 
-
-void EVE_cmd_bgcolor_burst(uint32_t color)
-{
-	spi_transmit_burst(CMD_BGCOLOR);
-	spi_transmit_burst(color);
+	#if defined (EVE_DMA)
+	EVE_init_dma(); /* prepare DMA */
+	#endif
 }
 
 
-void EVE_cmd_button(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
+/* init, has to be executed with the SPI setup to 11 MHz or less as required by FT8xx / BT8xx */
+uint8_t EVE_init(void)
 {
-	if(!cmd_burst)
+	if(!eve_init_start(42))
 	{
-		eve_begin_cmd(CMD_BUTTON);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
-
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
+		return 0;
+	}
 
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
+	eve_init_touch_controller();
+	eve_init_timing();
+	eve_init_touch_audio();
 
-		private_string_write(text);
-		EVE_cs_clear();
+	if(!eve_init_display(0, 0))
+	{
+		return 0;
 	}
-}
 
-
-void EVE_cmd_button_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
-{
-	spi_transmit_burst(CMD_BUTTON);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
-	private_string_write(text);
+	eve_init_end();
+	return 1;
 }
 
 
-void EVE_cmd_calibrate(void)
+/*
+Boot splash: show a display-list that was prepared at compile time as soon as EVE answers and leave the rest of the init
+for EVE_init_finish(), this can be called later, for example after the host loaded its own configuration.
+The list is written directly to RAM_DL, it can only use display-list commands like the bitmaps of the ROM fonts
+with VERTEX2II and with EVE_SPLASH_FLASH defined for BT81x also bitmaps that are stored in the flash.
+Touch, audio and the touch-controller patch are done in EVE_init_finish(), no EVE_cmd_xxx() besides the ones
+that EVE_init_finish() needs should be used before it.
+A list with more than 2048 words does not fit into RAM_DL and is rejected before EVE is touched.
+*/
+uint8_t EVE_init_splash(const uint32_t *list, uint16_t words)
 {
-	if(!cmd_burst)
+	if(words > (EVE_RAM_DL_SIZE / 4))
 	{
-		eve_begin_cmd(CMD_CALIBRATE);
-		spi_transmit_32(0);
-		EVE_cs_clear();
+		return 0;
 	}
-}
 
-
-void EVE_cmd_clock(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs)
-{
-	if(!cmd_burst)
+	if(!eve_init_start(0))
 	{
-		eve_begin_cmd(CMD_CLOCK);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
+		return 0;
+	}
 
-		spi_transmit((uint8_t)(r0));
-		spi_transmit((uint8_t)(r0 >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
+	eve_init_timing();
 
-		spi_transmit((uint8_t)(hours));
-		spi_transmit((uint8_t)(hours >> 8));
-		spi_transmit((uint8_t)(minutes));
-		spi_transmit((uint8_t)(minutes >> 8));
+	#if (EVE_GEN > 2) && defined (EVE_SPLASH_FLASH)
+	(void) EVE_init_flash(); /* a failure shows up as missing bitmaps on the splash, the init goes on */
+	#endif
 
-		spi_transmit((uint8_t)(seconds));
-		spi_transmit((uint8_t)(seconds >> 8));
-		spi_transmit((uint8_t)(millisecs));
-		spi_transmit((uint8_t)(millisecs >> 8));
-		EVE_cs_clear();
-	}
+	return eve_init_display(list, words);
 }
 
 
-void EVE_cmd_clock_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs)
+void EVE_init_finish(void)
 {
-	spi_transmit_burst(CMD_CLOCK);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) r0 + ((uint32_t) options << 16));
-	spi_transmit_burst((uint32_t) hours + ((uint32_t) minutes << 16));
-	spi_transmit_burst((uint32_t) seconds + ((uint32_t) millisecs << 16));
+	eve_init_touch_controller();
+	eve_init_touch_audio();
+	eve_init_end();
 }
 
 
-void EVE_cmd_dial(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val)
+/* the time from the ACTIVE command to the start of the pixel clock in micro-seconds */
+/* the power-down pulse and the wait after it add another 27ms and the first frame is displayed within one frame-time after this */
+uint32_t EVE_get_first_pixel_us(void)
 {
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_DIAL);
+	#if EVE_GEN > 2
+	return eve_first_pixel / 72U;
+	#else
+	return eve_first_pixel / 60U;
+	#endif
+}
 
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
 
-		spi_transmit((uint8_t)(r0));
-		spi_transmit((uint8_t)(r0 >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
+#define EVE_WARM_MAGIC 0x4d524157UL /* "WARM" */
 
-		spi_transmit((uint8_t)(val));
-		spi_transmit((uint8_t)(val >> 8));
-		spi_transmit(0);
-		spi_transmit(0);
+/*
+Warm start: when the host is reset by a watchdog, a brown-out or a firmware update, EVE may still be running
+with all the assets in RAM_G.
+EVE_warm_mark() stores a signature block after the assets were loaded, 16 bytes in RAM_G outside of the assets
+with a magic number, the area of the assets and the crc over it.
+EVE_init_warm() checks if EVE is running with the timing from EVE_config.h, if REG_FRAMES is counting and if the signature
+and the crc match, it skips the power-down and the init then and returns EVE_INIT_WARM, otherwise it calls EVE_init().
+The co-processor is always reset as the host may have been reset in the middle of a command,
+the state of the co-processor, like fonts set with CMD_SETFONT2 or CMD_ROMFONT, has to be set again.
+This needs the power-down pin to stay high thru the reset of the host.
+*/
+void EVE_warm_mark(uint32_t signature, uint32_t start, uint32_t size)
+{
+	uint32_t crc = EVE_cmd_memcrc(start, size);
 
-		EVE_cs_clear();
-	}
+	EVE_memWrite32(signature, EVE_WARM_MAGIC);
+	EVE_memWrite32(signature + 4U, start);
+	EVE_memWrite32(signature + 8U, size);
+	EVE_memWrite32(signature + 12U, crc);
 }
 
 
-void EVE_cmd_dial_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val)
+static uint8_t eve_warm_probe(uint32_t signature)
 {
-	spi_transmit_burst(CMD_DIAL);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) r0 + ((uint32_t) options << 16));
-	spi_transmit_burst(val);
-}
-
+	uint32_t frames;
+	uint8_t timeout = 0;
 
-void EVE_cmd_fgcolor(uint32_t color)
-{
-	if(!cmd_burst)
+	if((EVE_memRead8(REG_ID) != 0x7C) || ((EVE_memRead8(REG_CPURESET) & 0x07) != 0))
 	{
-		eve_begin_cmd(CMD_FGCOLOR);
-		spi_transmit((uint8_t)(color));
-		spi_transmit((uint8_t)(color >> 8));
-		spi_transmit((uint8_t)(color >> 16));
-		spi_transmit(0x00);
-		EVE_cs_clear();
+		return 0;
 	}
-}
-
-
-void EVE_cmd_fgcolor_burst(uint32_t color)
-{
-	spi_transmit_burst(CMD_FGCOLOR);
-	spi_transmit_burst(color);
-}
-
 
-void EVE_cmd_gauge(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range)
-{
-	if(!cmd_burst)
+	if((EVE_memRead16(REG_HSIZE) != EVE_HSIZE) || (EVE_memRead16(REG_VSIZE) != EVE_VSIZE) ||
+		(EVE_memRead16(REG_HCYCLE) != EVE_HCYCLE) || (EVE_memRead16(REG_VCYCLE) != EVE_VCYCLE) ||
+		(EVE_memRead8(REG_PCLK) != EVE_PCLK))
 	{
-		eve_begin_cmd(CMD_GAUGE);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(r0));
-		spi_transmit((uint8_t)(r0 >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-
-		spi_transmit((uint8_t)(major));
-		spi_transmit((uint8_t)(major >> 8));
-		spi_transmit((uint8_t)(minor));
-		spi_transmit((uint8_t)(minor >> 8));
-
-		spi_transmit((uint8_t)(val));
-		spi_transmit((uint8_t)(val >> 8));
-		spi_transmit((uint8_t)(range));
-		spi_transmit((uint8_t)(range >> 8));
-
-		EVE_cs_clear();
+		return 0;
 	}
-}
-
-
-void EVE_cmd_gauge_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range)
-{
-	spi_transmit_burst(CMD_GAUGE);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) r0 + ((uint32_t) options << 16));
-	spi_transmit_burst((uint32_t) major + ((uint32_t) minor << 16));
-	spi_transmit_burst((uint32_t) val + ((uint32_t) range << 16));
-}
-
 
-/* this function is meant to be called  with display-list building, but it waits for completion */
-/* as this function returns values by writing to the command-fifo, it can not be used with cmd-burst */
-/* get the properties of the bitmap transform matrix and write the values to the variables that are supplied by pointers */
-void EVE_cmd_getmatrix(int32_t *get_a, int32_t *get_b, int32_t *get_c, int32_t *get_d, int32_t *get_e, int32_t *get_f)
-{
-	if(!cmd_burst)
+	frames = EVE_memRead32(REG_FRAMES);
+	while(EVE_memRead32(REG_FRAMES) == frames) /* the panel is being refreshed, at least 20 times per second */
 	{
-		uint16_t cmdoffset;
-
-		eve_begin_cmd(CMD_GETMATRIX);
-		spi_transmit_32(0);
-		spi_transmit_32(0);
-		spi_transmit_32(0);
-		spi_transmit_32(0);
-		spi_transmit_32(0);
-		spi_transmit_32(0);
-		EVE_cs_clear();
-		while (EVE_busy());
-		cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
-
-		if(get_f)
-		{
-			*get_f = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
-		}
-		if(get_e)
-		{
-			*get_e = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
-		}
-		if(get_d)
-		{
-			*get_d = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 12) & 0xfff));
-		}
-		if(get_c)
-		{
-			*get_c = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 16) & 0xfff));
-		}
-		if(get_b)
-		{
-			*get_b = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 20) & 0xfff));
-		}
-		if(get_a)
+		DELAY_MS(1);
+		timeout++;
+		if(timeout > 50)
 		{
-			*get_a = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 24) & 0xfff));
+			return 0;
 		}
 	}
-}
-
 
-void EVE_cmd_gradcolor(uint32_t color)
-{
-	if(!cmd_burst)
+	if(EVE_memRead32(signature) != EVE_WARM_MAGIC)
 	{
-		eve_begin_cmd(CMD_GRADCOLOR);
-		spi_transmit((uint8_t)(color));
-		spi_transmit((uint8_t)(color >> 8));
-		spi_transmit((uint8_t)(color >> 16));
-		spi_transmit(0x00);
-		EVE_cs_clear();
+		return 0;
 	}
-}
 
-
-void EVE_cmd_gradcolor_burst(uint32_t color)
-{
-	spi_transmit_burst(CMD_GRADCOLOR);
-	spi_transmit_burst(color);
+	eve_reset_copro();
+	return (EVE_cmd_memcrc(EVE_memRead32(signature + 4U), EVE_memRead32(signature + 8U)) == EVE_memRead32(signature + 12U)) ? 1 : 0;
 }
 
 
-void EVE_cmd_gradient(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1)
+/* returns EVE_INIT_WARM if EVE was still running with the assets intact, EVE_INIT_COLD after a full init or 0 if that failed */
+uint8_t EVE_init_warm(uint32_t signature)
 {
-	if(!cmd_burst)
+	if(eve_warm_probe(signature))
 	{
-		eve_begin_cmd(CMD_GRADIENT);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(rgb0));
-		spi_transmit((uint8_t)(rgb0 >> 8));
-		spi_transmit((uint8_t)(rgb0 >> 16));
-		spi_transmit(0x00);
-
-		spi_transmit((uint8_t)(x1));
-		spi_transmit((uint8_t)(x1 >> 8));
-		spi_transmit((uint8_t)(y1));
-		spi_transmit((uint8_t)(y1 >> 8));
-
-		spi_transmit((uint8_t)(rgb1));
-		spi_transmit((uint8_t)(rgb1 >> 8));
-		spi_transmit((uint8_t)(rgb1 >> 16));
-		spi_transmit(0x00);
-
-		EVE_cs_clear();
+		eve_init_end();
+		return EVE_INIT_WARM;
 	}
+	return EVE_init();
 }
 
 
-void EVE_cmd_gradient_burst(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1)
-{
-	spi_transmit_burst(CMD_GRADIENT);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst(rgb0);
-	spi_transmit_burst((uint32_t) x1 + ((uint32_t) y1 << 16));
-	spi_transmit_burst(rgb1);
-}
-
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*-------- functions for display lists ---------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
 
-void EVE_cmd_keys(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
+/*
+These eliminate the overhead of transmitting the command-fifo address with every single command, just wrap a sequence of commands
+with these and the address is only transmitted once at the start of the block.
+Be careful to not use any functions in the sequence that do not address the command-fifo as for example any EVE_mem...() function.
+*/
+void EVE_start_cmd_burst(void)
 {
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_KEYS);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
-
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
+	uint32_t ftAddress;
 
-		private_string_write(text);
-		EVE_cs_clear();
+#if defined (EVE_DMA)
+	if(EVE_dma_busy)
+	{
+		while (EVE_busy()); /* this is a safe-guard to protect segmented display-list building with DMA from overlapping */
 	}
-}
-
+#endif
 
-void EVE_cmd_keys_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
-{
-	spi_transmit_burst(CMD_KEYS);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	cmd_burst = 42;
+	ftAddress = REG_CMDB_WRITE;
 
-	private_string_write(text);
+	#if defined (EVE_DMA)
+		#if defined (EVE_DMA_THREAD)
+		if(EVE_dma_buffer == NULL)
+		{
+			EVE_dma_buffer = EVE_dma_thread_buffer(); /* first burst of the calling thread */
+		}
+		#endif
+		/* 0x low mid hi 00 */
+		EVE_dma_buffer[0] = ((uint8_t)(ftAddress >> 16) | MEM_WRITE) | (ftAddress & 0x0000ff00) |  ((uint8_t)(ftAddress) << 16);
+		EVE_dma_buffer[0] = EVE_dma_buffer[0] << 8;
+		EVE_dma_buffer_index = 1;
+	#else
+		EVE_cs_set();
+		spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
+		spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
+		spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
+	#endif
 }
 
 
-void EVE_cmd_number(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number)
+void EVE_end_cmd_burst(void)
 {
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_NUMBER);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
+	cmd_burst = 0;
 
-		spi_transmit_32(number);
+	#if defined (EVE_DMA)
+		EVE_start_dma_transfer(); /* begin DMA transfer */
+	#else
 		EVE_cs_clear();
-	}
+	#endif
 }
 
 
-void EVE_cmd_number_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number)
-{
-	spi_transmit_burst(CMD_NUMBER);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
-	spi_transmit_burst(number);
-}
+/*
+The string functions below move the text in 32 bit words, this is the unit the command-fifo works with anyways.
+The first character goes into the lowest byte of a word as spi_transmit_32() and spi_transmit_burst() send the lowest byte first.
+On little-endian controllers that are fine with 32 bit reads from aligned addresses four characters are read at once
+and a SWAR test is used to find the terminating zero, all other controllers and unaligned strings assemble the words byte by byte.
+Reading the word that holds the terminating zero can read up to three bytes past the end of the string.
+An aligned word can not cross a page or an MPU region so this can not fault, but it is outside the string as far as C is concerned.
+So this is only done with GCC and clang, the word is read thru a may_alias type and string_word() is excluded from the address sanitizer.
+There is no limit for the length of a string anymore, non-burst commands split long strings into several transfers to not overrun the fifo.
+With cmd-burst the total size of the burst is still up to the caller, just like with everything else in a burst.
+*/
+#if defined (__GNUC__) && !defined (__AVR__) && !(defined (__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__))
+#define EVE_STRING_WORD_READ
 
+typedef uint32_t __attribute__((__may_alias__)) string_word_t;
 
-void EVE_cmd_progress(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_PROGRESS);
+#if defined (__has_attribute)
+#if __has_attribute(__no_sanitize_address__)
+#define EVE_STRING_NO_ASAN __attribute__((__no_sanitize_address__))
+#endif
+#endif
+#endif
 
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
+#if !defined (EVE_STRING_NO_ASAN)
+#define EVE_STRING_NO_ASAN
+#endif
 
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
+#define EVE_STRING_CHUNK 3584UL /* max amount of bytes from a string per transfer, leaves room for the command and its parameters */
 
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-		spi_transmit((uint8_t)(val));
-		spi_transmit((uint8_t)(val >> 8));
 
-		spi_transmit((uint8_t)(range));
-		spi_transmit((uint8_t)(range >> 8));
-		spi_transmit(0x00);	/* dummy byte for 4-byte alignment */
-		spi_transmit(0x00); /* dummy byte for 4-byte alignment */
+/* read four bytes of a string into one word, the caller has to make sure that these four bytes are part of the string */
+static inline uint32_t string_load(const uint8_t *bytes)
+{
+#if defined (EVE_STRING_WORD_READ)
+	if(((uintptr_t) bytes & 3U) == 0U)
+	{
+		uint32_t word;
 
-		EVE_cs_clear();
+		memcpy(&word, bytes, 4U); /* a single 32 bit read, without breaking the aliasing rules */
+		return word;
 	}
+#endif
+	return ((uint32_t) bytes[0]) | (((uint32_t) bytes[1]) << 8) | (((uint32_t) bytes[2]) << 16) | (((uint32_t) bytes[3]) << 24);
 }
 
 
-void EVE_cmd_progress_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
+/* fetch the next four characters of a zero-terminated string as one word, returns 0 when the terminating zero is in the word */
+/* all bytes following the terminating zero are cleared */
+EVE_STRING_NO_ASAN static uint8_t string_word(const uint8_t *bytes, uint32_t *word)
 {
-	spi_transmit_burst(CMD_PROGRESS);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst((uint32_t) options + ((uint32_t) val << 16));
-	spi_transmit_burst(range);
-}
-
+	uint32_t data = 0;
+	uint8_t index;
 
-void EVE_cmd_romfont(uint32_t font, uint32_t romslot)
-{
-	if(!cmd_burst)
+#if defined (EVE_STRING_WORD_READ)
+	if(((uintptr_t) bytes & 3U) == 0U)
 	{
-		eve_begin_cmd(CMD_ROMFONT);
+		data = *((const string_word_t *) bytes); /* an aligned word can not cross a page boundary, this is safe even if the string ends in it */
 
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
-		spi_transmit(0x00);
-		spi_transmit(0x00);
+		if(((data - 0x01010101UL) & ~data & 0x80808080UL) == 0) /* none of the four bytes is zero */
+		{
+			*word = data;
+			return 1;
+		}
 
-		spi_transmit((uint8_t)(romslot));
-		spi_transmit((uint8_t)(romslot >> 8));
-		spi_transmit(0x00);
-		spi_transmit(0x00);
+		if((data & 0x000000ffUL) == 0)
+		{
+			data = 0;
+		}
+		else if((data & 0x0000ff00UL) == 0)
+		{
+			data &= 0x000000ffUL;
+		}
+		else if((data & 0x00ff0000UL) == 0)
+		{
+			data &= 0x0000ffffUL;
+		}
+		else
+		{
+			data &= 0x00ffffffUL;
+		}
 
-		EVE_cs_clear();
+		*word = data;
+		return 0;
 	}
-}
+#endif
 
+	for(index = 0; index < 4U; index++)
+	{
+		uint8_t byte = bytes[index];
 
-void EVE_cmd_romfont_burst(uint32_t font, uint32_t romslot)
-{
-	spi_transmit_burst(CMD_ROMFONT);
-	spi_transmit_burst(font);
-	spi_transmit_burst(romslot);
+		if(byte == 0) /* do not read past the end of the string */
+		{
+			*word = data;
+			return 0;
+		}
+		data |= ((uint32_t) byte) << (index * 8U);
+	}
+
+	*word = data;
+	return 1;
 }
 
 
-void EVE_cmd_rotate(int32_t angle)
+/* the last word of a string with a given length, holds the remaining 0...3 characters and the terminating zero */
+static inline uint32_t string_tail(const uint8_t *bytes, uint32_t length)
 {
-	if(!cmd_burst)
+	uint32_t data = 0;
+	uint8_t index;
+
+	for(index = 0; index < length; index++)
 	{
-		eve_begin_cmd(CMD_ROTATE);
-		spi_transmit_32(angle);
-		EVE_cs_clear();
+		data |= ((uint32_t) bytes[index]) << (index * 8U);
 	}
-}
-
 
-void EVE_cmd_rotate_burst(int32_t angle)
-{
-	spi_transmit_burst(CMD_ROTATE);
-	spi_transmit_burst(angle);
+	return data;
 }
 
 
-void EVE_cmd_scale(int32_t sx, int32_t sy)
+/* pack a zero-terminated string into words the way EVE expects it in the command-fifo, including the terminating zero */
+/* the result can be used with EVE_cmd_text_packed() / EVE_cmd_text_packed_burst() to not convert the same text again and again */
+/* returns the number of words used or 0 if max_words is not enough for the string */
+uint16_t EVE_pack_string(uint32_t *words, uint16_t max_words, const char *text)
 {
-	if(!cmd_burst)
+	const uint8_t *bytes = (const uint8_t *) text;
+	uint16_t count = 0;
+	uint8_t more = 1;
+
+	while(more)
 	{
-		eve_begin_cmd(CMD_SCALE);
-		spi_transmit_32(sx);
-		spi_transmit_32(sy);
-		EVE_cs_clear();
+		if(count == max_words)
+		{
+			return 0;
+		}
+		more = string_word(bytes, &words[count]);
+		bytes += 4;
+		count++;
 	}
+
+	return count;
 }
 
 
-void EVE_cmd_scale_burst(int32_t sx, int32_t sy)
+#if !defined (EVE_BURST_ONLY)
+
+/* address the command-fifo without sending a command, used to continue a command that was split into several transfers */
+static void eve_begin_cmdb(void)
 {
-	spi_transmit_burst(CMD_SCALE);
-	spi_transmit_burst(sx);
-	spi_transmit_burst(sy);
+	uint32_t ftAddress;
+
+	ftAddress = REG_CMDB_WRITE;
+	EVE_cs_set();
+	spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE); /* send Memory Write plus high address byte */
+	spi_transmit((uint8_t)(ftAddress >> 8)); /* send middle address byte */
+	spi_transmit((uint8_t)(ftAddress)); /* send low address byte */
 }
 
 
-void EVE_cmd_scrollbar(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range)
+/* write one word of a string, splits the transfer once EVE_STRING_CHUNK bytes were sent */
+/* the co-processor already works on the command and takes the rest of the string from the fifo as it arrives */
+static void string_transmit(uint32_t word, uint32_t *count)
 {
-	if(!cmd_burst)
+	if(*count >= EVE_STRING_CHUNK)
 	{
-		eve_begin_cmd(CMD_SCROLLBAR);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
-
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-		spi_transmit((uint8_t)(val));
-		spi_transmit((uint8_t)(val >> 8));
-
-		spi_transmit((uint8_t)(size));
-		spi_transmit((uint8_t)(size >> 8));
-		spi_transmit((uint8_t)(range));
-		spi_transmit((uint8_t)(range >> 8));
-
 		EVE_cs_clear();
+		while (EVE_busy());
+		eve_begin_cmdb();
+		*count = 0;
 	}
-}
 
-
-void EVE_cmd_scrollbar_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range)
-{
-	spi_transmit_burst(CMD_SCROLLBAR);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst((uint32_t) options + ((uint32_t) val << 16));
-	spi_transmit_burst((uint32_t) size + ((uint32_t) range << 16));
+	spi_transmit_32(word);
+	*count += 4;
 }
 
 
-void EVE_cmd_setbase(uint32_t base)
+/* write a string to co-processor memory in context of a command: no chip-select, just plain SPI-transfers */
+void private_string_write(const char *text)
 {
-	if(!cmd_burst)
+	const uint8_t *bytes = (const uint8_t *) text;
+	uint32_t count = 0;
+	uint32_t word;
+	uint8_t more;
+
+	do
 	{
-		eve_begin_cmd(CMD_SETBASE);
-		spi_transmit_32(base);
-		EVE_cs_clear();
-	}
+		more = string_word(bytes, &word);
+		string_transmit(word, &count);
+		bytes += 4;
+	} while(more);
 }
 
 
-void EVE_cmd_setbase_burst(uint32_t base)
+/* write a string with a known length, the terminating zero is added */
+void private_string_write_len(const char *text, uint32_t length)
 {
-	spi_transmit_burst(CMD_SETBASE);
-	spi_transmit_burst(base);
-}
-
+	const uint8_t *bytes = (const uint8_t *) text;
+	uint32_t count = 0;
 
-void EVE_cmd_setbitmap(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height)
-{
-	if(!cmd_burst)
+	while(length > 3)
 	{
-		eve_begin_cmd(CMD_SETBITMAP);
-		spi_transmit_32(addr);
-
-		spi_transmit((uint8_t)(fmt));
-		spi_transmit((uint8_t)(fmt>> 8));
-		spi_transmit((uint8_t)(width));
-		spi_transmit((uint8_t)(width >> 8));
-
-		spi_transmit((uint8_t)(height));
-		spi_transmit((uint8_t)(height >> 8));
-		spi_transmit(0);
-		spi_transmit(0);
-
-		EVE_cs_clear();
+		string_transmit(string_load(bytes), &count);
+		bytes += 4;
+		length -= 4;
 	}
-}
 
-
-void EVE_cmd_setbitmap_burst(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height)
-{
-	spi_transmit_burst(CMD_SETBITMAP);
-	spi_transmit_burst(addr);
-	spi_transmit_burst((uint32_t) fmt + ((uint32_t) width << 16));
-	spi_transmit_burst(height);
+	string_transmit(string_tail(bytes, length), &count);
 }
 
 
-void EVE_cmd_setfont(uint32_t font, uint32_t ptr)
+/* write a string that already was packed with EVE_pack_string() */
+void private_words_write(const uint32_t *words, uint32_t num)
 {
-	if(!cmd_burst)
+	uint32_t count = 0;
+
+	while(num > 0)
 	{
-		eve_begin_cmd(CMD_SETFONT);
-		spi_transmit_32(font);
-		spi_transmit_32(ptr);
-		EVE_cs_clear();
+		string_transmit(*words++, &count);
+		num--;
 	}
 }
 
+#endif /* EVE_BURST_ONLY */
 
-void EVE_cmd_setfont_burst(uint32_t font, uint32_t ptr)
-{
-	spi_transmit_burst(CMD_SETFONT);
-	spi_transmit_burst(font);
-	spi_transmit_burst(ptr);
-}
 
+#if !defined (EVE_NO_BURST)
 
-void EVE_cmd_setfont2(uint32_t font, uint32_t ptr, uint32_t firstchar)
+/* the same as private_string_write() but for cmd-burst, either directly to SPI or to the DMA buffer */
+void private_string_write_burst(const char *text)
 {
-	if(!cmd_burst)
+	const uint8_t *bytes = (const uint8_t *) text;
+	uint32_t word;
+	uint8_t more;
+
+	do
 	{
-		eve_begin_cmd(CMD_SETFONT2);
-		spi_transmit_32(font);
-		spi_transmit_32(ptr);
-		spi_transmit_32(firstchar);
-		EVE_cs_clear();
-	}
+		more = string_word(bytes, &word);
+		spi_transmit_burst(word);
+		bytes += 4;
+	} while(more);
 }
 
 
-void EVE_cmd_setfont2_burst(uint32_t font, uint32_t ptr, uint32_t firstchar)
+void private_string_write_len_burst(const char *text, uint32_t length)
 {
-	spi_transmit_burst(CMD_SETFONT2);
-	spi_transmit_burst(font);
-	spi_transmit_burst(ptr);
-	spi_transmit_burst(firstchar);
-}
+	const uint8_t *bytes = (const uint8_t *) text;
 
-
-void EVE_cmd_setscratch(uint32_t handle)
-{
-	if(!cmd_burst)
+	while(length > 3)
 	{
-		eve_begin_cmd(CMD_SETSCRATCH);
-		spi_transmit_32(handle);
-		EVE_cs_clear();
+		spi_transmit_burst(string_load(bytes));
+		bytes += 4;
+		length -= 4;
 	}
-}
 
-
-void EVE_cmd_setscratch_burst(uint32_t handle)
-{
-	spi_transmit_burst(CMD_SETSCRATCH);
-	spi_transmit_burst(handle);
+	spi_transmit_burst(string_tail(bytes, length));
 }
 
 
-void EVE_cmd_sketch(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format)
+/* with DMA the words are copied into EVE_dma_buffer in one go, this is what makes replaying pre-encoded commands cheap */
+/* the copy stops where EVE_dma_buffer_index would wrap around, the size of the buffer itself is up to the caller as always */
+void private_words_write_burst(const uint32_t *words, uint32_t num)
 {
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_SKETCH);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
-
-		spi_transmit_32(ptr);
-
-		spi_transmit((uint8_t)(format));
-		spi_transmit((uint8_t)(format >> 8));
-		spi_transmit(0);
-		spi_transmit(0);
+#if defined (EVE_DMA)
+	uint16_t index = EVE_dma_buffer_index;
 
-		EVE_cs_clear();
+	if(num > (0xffffUL - index))
+	{
+		num = 0xffffUL - index;
 	}
+	memcpy(&EVE_dma_buffer[index], words, num * 4UL);
+	EVE_dma_buffer_index = index + (uint16_t) num;
+#else
+	while(num > 0)
+	{
+		spi_transmit_burst(*words++);
+		num--;
+	}
+#endif
 }
 
+#endif /* EVE_NO_BURST */
 
-void EVE_cmd_sketch_burst(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format)
-{
-	spi_transmit_burst(CMD_SKETCH);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst(ptr);
-	spi_transmit_burst(format);
-}
 
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- host-side formatting --------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
 
-void EVE_cmd_slider(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
-{
-	if(!cmd_burst)
-	{
-		eve_begin_cmd(CMD_SLIDER);
+/*
+FT81x do not have EVE_OPT_FORMAT, so for these the _var functions convert the string on the host.
+This is not a replacement for snprintf(), there is no buffer and no floating point, the characters are packed into words
+and go straight to SPI or the DMA buffer.
+Supported are %d, %i, %u, %o, %x, %X, %c and %% with the flags '-', '0', '+' and ' ', a field width and a precision.
+%s can not be supported as EVE expects an address in RAM_G for it, the argument is skipped.
+EVE_cmd_number_fixed() uses the same code for numbers with a fixed amount of decimal places on all generations.
+*/
 
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
+#define FORMAT_LEFT  1U
+#define FORMAT_ZERO  2U
+#define FORMAT_PLUS  4U
+#define FORMAT_SPACE 8U
 
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(h0));
-		spi_transmit((uint8_t)(h0 >> 8));
+typedef struct
+{
+	uint32_t word;
+	uint32_t count; /* bytes sent in the current transfer, for string_transmit() */
+	uint8_t bytes;
+	uint8_t burst;
+} format_stream;
 
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-		spi_transmit((uint8_t)(val));
-		spi_transmit((uint8_t)(val >> 8));
 
-		spi_transmit((uint8_t)(range));
-		spi_transmit((uint8_t)(range >> 8));
-		spi_transmit(0x00); /* dummy byte for 4-byte alignment */
-		spi_transmit(0x00); /* dummy byte for 4-byte alignment */
+static void stream_put(format_stream *stream, uint8_t data)
+{
+	stream->word |= ((uint32_t) data) << (stream->bytes * 8U);
+	stream->bytes++;
 
-		EVE_cs_clear();
+	if(stream->bytes == 4U)
+	{
+#if !defined (EVE_NO_BURST)
+		if(stream->burst)
+		{
+			spi_transmit_burst(stream->word);
+		}
+		else
+#endif
+		{
+#if !defined (EVE_BURST_ONLY)
+			string_transmit(stream->word, &stream->count);
+#endif
+		}
+		stream->word = 0;
+		stream->bytes = 0;
 	}
 }
 
 
-void EVE_cmd_slider_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
+/* terminate the string and send out the last word with the padding */
+static void stream_end(format_stream *stream)
 {
-	spi_transmit_burst(CMD_SLIDER);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
-	spi_transmit_burst((uint32_t) options + ((uint32_t) val << 16));
-	spi_transmit_burst(range);
+	do
+	{
+		stream_put(stream, 0);
+	} while(stream->bytes != 0);
 }
 
 
-void EVE_cmd_spinner(int16_t x0, int16_t y0, uint16_t style, uint16_t scale)
+static void stream_fill(format_stream *stream, uint8_t data, uint8_t count)
 {
-	if(!cmd_burst)
+	while(count > 0)
 	{
-		eve_begin_cmd(CMD_SPINNER);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
-
-		spi_transmit((uint8_t)(style));
-		spi_transmit((uint8_t)(style >> 8));
-		spi_transmit((uint8_t)(scale));
-		spi_transmit((uint8_t)(scale >> 8));
-
-		EVE_cs_clear();
+		stream_put(stream, data);
+		count--;
 	}
 }
 
 
-void EVE_cmd_spinner_burst(int16_t x0, int16_t y0, uint16_t style, uint16_t scale)
+/* put a number into the stream, "precision" is the minimum amount of digits and "decimals" the amount of digits after the point */
+static void stream_number(format_stream *stream, uint32_t value, uint8_t sign, uint8_t base, uint8_t upper, uint8_t flags, uint8_t width, int16_t precision, uint8_t decimals)
 {
-	spi_transmit_burst(CMD_SPINNER);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) style + ((uint32_t) scale << 16));
-}
-
+	char digits[12]; /* 4294967295 or 37777777777 */
+	uint8_t count = 0;
+	uint16_t zeros = 0;
+	uint16_t length;
+	uint16_t padding = 0;
+	uint16_t minimum;
+	uint16_t position;
 
-void EVE_cmd_text(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text)
-{
-	if(!cmd_burst)
+	while(value != 0)
 	{
-		eve_begin_cmd(CMD_TEXT);
-
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
+		digits[count++] = (upper ? "0123456789ABCDEF" : "0123456789abcdef")[value % base];
+		value /= base;
+	}
 
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
+	if(precision < 0)
+	{
+		minimum = 1; /* a zero is printed as "0" */
+	}
+	else
+	{
+		minimum = (uint16_t) precision; /* up to 255 like the width */
+	}
 
-		private_string_write(text);
-		EVE_cs_clear();
+	if((decimals != 0) && (minimum <= decimals))
+	{
+		minimum = decimals + 1U; /* "0.05" and not ".05" */
 	}
-}
 
+	if(count < minimum)
+	{
+		zeros = minimum - count;
+	}
 
-void EVE_cmd_text_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text)
-{
-	spi_transmit_burst(CMD_TEXT);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
-	private_string_write(text);
-}
+	length = count + zeros + ((sign != 0) ? 1U : 0U) + ((decimals != 0) ? 1U : 0U);
 
+	if(width > length)
+	{
+		padding = width - length;
+	}
 
-void EVE_cmd_toggle(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text)
-{
-	if(!cmd_burst)
+	if((flags & FORMAT_ZERO) && !(flags & FORMAT_LEFT) && (precision < 0))
 	{
-		eve_begin_cmd(CMD_TOGGLE);
+		zeros += padding;
+		padding = 0;
+	}
 
-		spi_transmit((uint8_t)(x0));
-		spi_transmit((uint8_t)(x0 >> 8));
-		spi_transmit((uint8_t)(y0));
-		spi_transmit((uint8_t)(y0 >> 8));
+	if(!(flags & FORMAT_LEFT))
+	{
+		stream_fill(stream, ' ', (uint8_t) padding);
+	}
 
-		spi_transmit((uint8_t)(w0));
-		spi_transmit((uint8_t)(w0 >> 8));
-		spi_transmit((uint8_t)(font));
-		spi_transmit((uint8_t)(font >> 8));
+	if(sign != 0)
+	{
+		stream_put(stream, sign);
+	}
 
-		spi_transmit((uint8_t)(options));
-		spi_transmit((uint8_t)(options >> 8));
-		spi_transmit((uint8_t)(state));
-		spi_transmit((uint8_t)(state >> 8));
+	position = count + zeros;
+	while(position > 0)
+	{
+		position--;
+		if((decimals != 0) && (position == (decimals - 1U)))
+		{
+			stream_put(stream, '.');
+		}
+		stream_put(stream, (position < count) ? (uint8_t) digits[position] : (uint8_t) '0');
+	}
 
-		private_string_write(text);
-		EVE_cs_clear();
+	if(flags & FORMAT_LEFT)
+	{
+		stream_fill(stream, ' ', (uint8_t) padding);
 	}
 }
 
 
-void EVE_cmd_toggle_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text)
+#if EVE_GEN < 3
+/* read the digits of a field width or a precision, values above 255 are limited to 255 */
+static uint8_t format_digits(const uint8_t **bytes)
 {
-	spi_transmit_burst(CMD_TOGGLE);
-	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
-	spi_transmit_burst((uint32_t) w0 + ((uint32_t) font << 16));
-	spi_transmit_burst((uint32_t) options + ((uint32_t) state << 16));
-	private_string_write(text);
-}
+	uint16_t value = 0;
 
-
-void EVE_cmd_translate(int32_t tx, int32_t ty)
-{
-	if(!cmd_burst)
+	while((**bytes >= '0') && (**bytes <= '9'))
 	{
-		eve_begin_cmd(CMD_TRANSLATE);
-		spi_transmit_32(tx);
-		spi_transmit_32(ty);
-		EVE_cs_clear();
+		if(value < 256U)
+		{
+			value = (value * 10U) + (**bytes - '0');
+		}
+		(*bytes)++;
 	}
-}
 
-
-void EVE_cmd_translate_burst(int32_t tx, int32_t ty)
-{
-	spi_transmit_burst(CMD_TRANSLATE);
-	spi_transmit_burst(tx);
-	spi_transmit_burst(ty);
+	return (value > 255U) ? 255U : (uint8_t) value;
 }
 
 
-void EVE_color_rgb(uint32_t color)
+/* put the string into the stream and replace the conversion specifications with the arguments */
+static void stream_format(format_stream *stream, const char *text, uint8_t num_args, va_list arguments)
 {
-	if(!cmd_burst)
+	const uint8_t *bytes = (const uint8_t *) text;
+	uint8_t counter = 0;
+
+	while(*bytes != 0)
 	{
-		eve_begin_cmd(DL_COLOR_RGB | color);
-		EVE_cs_clear();
-	}
-}
+		uint8_t flags = 0;
+		uint8_t width = 0;
+		int16_t precision = -1;
+		uint8_t conversion;
+		int32_t value = 0;
 
+		if(*bytes != '%')
+		{
+			stream_put(stream, *bytes++);
+			continue;
+		}
+		bytes++;
 
-void EVE_color_rgb_burst(uint32_t color)
-{
-	spi_transmit_burst(DL_COLOR_RGB | color);
-}
+		while((*bytes == '-') || (*bytes == '0') || (*bytes == '+') || (*bytes == ' ')) /* flags */
+		{
+			switch(*bytes)
+			{
+				case '-':
+					flags |= FORMAT_LEFT;
+					break;
+				case '0':
+					flags |= FORMAT_ZERO;
+					break;
+				case '+':
+					flags |= FORMAT_PLUS;
+					break;
+				default:
+					flags |= FORMAT_SPACE;
+					break;
+			}
+			bytes++;
+		}
 
+		width = format_digits(&bytes);
 
-/*---------------------------------------------------------------------------------------------------------------------------*/
-/*-------- special purpose functions ------------------- --------------------------------------------------------------------*/
-/*---------------------------------------------------------------------------------------------------------------------------*/
+		if(*bytes == '.')
+		{
+			bytes++;
+			precision = format_digits(&bytes);
+		}
 
+		while((*bytes == 'l') || (*bytes == 'h')) /* EVE only knows 32 bit values anyways */
+		{
+			bytes++;
+		}
 
-/* this is meant to be called outside display-list building */
-/* this function displays an interactive calibration screen, calculates the calibration values and */
-/* writes the new values to the touch matrix registers of EVE */
-/* unlike the built-in cmd_calibrate() of EVE this also works with displays that are cut down from larger ones like EVE2-38A / EVE2-38G */
-/* the height is needed as parameter as EVE_VSIZE for the EVE2-38 is 272 but the visible size is only 116 */
-/* so the call would be EVE_calibrate_manual(116); for the EVE2-38A and EVE2-38G while for most other displays */
-/* using EVE_calibrate_manual(EVE_VSIZE) would work - but for normal displays the built-in cmd_calibrate would work as expected anyways */
-/* this code was taken from the MatrixOrbital EVE2-Library on Github, adapted and modified */
-void EVE_calibrate_manual(uint16_t height)
-{
-	uint32_t displayX[3], displayY[3];
-	uint32_t touchX[3], touchY[3];
-	uint32_t touchValue;
-	int32_t tmp, k;
-	int32_t TransMatrix[6];
-	uint8_t count = 0;
-	char num[2];
-	uint8_t touch_lock = 1;
-
-	/* these values determine where your calibration points will be drawn on your display */
-	displayX[0] = (EVE_HSIZE * 0.15);
-	displayY[0] = (height * 0.15);
-
-	displayX[1] = (EVE_HSIZE * 0.85);
-	displayY[1] = (height / 2);
-
-	displayX[2] = (EVE_HSIZE / 2);
-	displayY[2] = (height * 0.85);
-
-	while (count < 3)
-	{
-		EVE_cmd_dl(CMD_DLSTART);
-		EVE_cmd_dl(DL_CLEAR_RGB | 0x000000);
-		EVE_cmd_dl(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
-
-		/* draw Calibration Point on screen */
-		EVE_cmd_dl(DL_COLOR_RGB | 0x0000ff);
-		EVE_cmd_dl(POINT_SIZE(20*16));
-		EVE_cmd_dl((DL_BEGIN | EVE_POINTS));
-		EVE_cmd_dl(VERTEX2F((uint32_t)(displayX[count]) * 16, (uint32_t)((displayY[count])) * 16));
-		EVE_cmd_dl(DL_END);
-		EVE_cmd_dl(DL_COLOR_RGB | 0xffffff);
-		EVE_cmd_text((EVE_HSIZE/2), 50, 27, EVE_OPT_CENTER, "Please tap on the dot.");
-		num[0] = count + 0x31; num[1] = 0; /* null terminated string of one character */
-		EVE_cmd_text(displayX[count], displayY[count], 27, EVE_OPT_CENTER, num);
-
-		EVE_cmd_dl(DL_DISPLAY);
-		EVE_cmd_dl(CMD_SWAP);
-		while (EVE_busy());
+		conversion = *bytes;
+		if(conversion == 0)
+		{
+			break;
+		}
+		bytes++;
+
+		if(conversion == '%')
+		{
+			stream_put(stream, '%');
+			continue;
+		}
 
-		while(1)
+		if(counter < num_args)
 		{
-			touchValue = EVE_memRead32(REG_TOUCH_DIRECT_XY); /* read for any new touch tag inputs */
+			value = (int32_t) va_arg(arguments, int);
+			counter++;
+		}
 
-			if(touch_lock)
+		switch(conversion)
+		{
+			case 'd':
+			case 'i':
 			{
-				if(touchValue & 0x80000000) /* check if we have no touch */
+				uint8_t sign = 0;
+				uint32_t magnitude = (uint32_t) value;
+
+				if(value < 0)
 				{
-					touch_lock = 0;
+					sign = '-';
+					magnitude = 0UL - magnitude;
 				}
-			}
-			else
-			{
-				if (!(touchValue & 0x80000000)) /* check if a touch is detected */
+				else if(flags & FORMAT_PLUS)
+				{
+					sign = '+';
+				}
+				else if(flags & FORMAT_SPACE)
 				{
-					touchX[count] = (touchValue>>16) & 0x03FF; /* raw Touchscreen Y coordinate */
-					touchY[count] = touchValue & 0x03FF; /* raw Touchscreen Y coordinate */
-					touch_lock = 1;
-					count++;
-					break; /* leave while(1) */
+					sign = ' ';
 				}
+				stream_number(stream, magnitude, sign, 10, 0, flags, width, precision, 0);
+				break;
 			}
+			case 'u':
+				stream_number(stream, (uint32_t) value, 0, 10, 0, flags, width, precision, 0);
+				break;
+			case 'o':
+				stream_number(stream, (uint32_t) value, 0, 8, 0, flags, width, precision, 0);
+				break;
+			case 'x':
+				stream_number(stream, (uint32_t) value, 0, 16, 0, flags, width, precision, 0);
+				break;
+			case 'X':
+				stream_number(stream, (uint32_t) value, 0, 16, 1, flags, width, precision, 0);
+				break;
+			case 'c':
+				if(!(flags & FORMAT_LEFT) && (width > 1U))
+				{
+					stream_fill(stream, ' ', width - 1U);
+				}
+				stream_put(stream, (uint8_t) value);
+				if((flags & FORMAT_LEFT) && (width > 1U))
+				{
+					stream_fill(stream, ' ', width - 1U);
+				}
+				break;
+			case 's': /* argument is an address in RAM_G, nothing the host can do with it */
+				break;
+			default: /* unknown, pass it on as it is */
+				stream_put(stream, '%');
+				stream_put(stream, conversion);
+				break;
 		}
 	}
 
-	k = ((touchX[0] - touchX[2])*(touchY[1] - touchY[2])) - ((touchX[1] - touchX[2])*(touchY[0] - touchY[2]));
+	stream_end(stream);
+}
+#endif
+
+
+/* put a signed or unsigned number with a fixed amount of decimal places into the stream */
+/* the options are the ones from EVE_cmd_number(): the low byte is the minimum amount of digits, EVE_OPT_SIGNED marks signed values */
+static void stream_fixed(format_stream *stream, int32_t number, uint16_t options, uint8_t decimals)
+{
+	uint32_t magnitude = (uint32_t) number;
+	uint8_t sign = 0;
+	int16_t precision = -1;
+
+	if((options & EVE_OPT_SIGNED) && (number < 0))
+	{
+		sign = '-';
+		magnitude = 0UL - magnitude;
+	}
+
+	if((options & 0xffU) != 0)
+	{
+		precision = (int16_t) (options & 0xffU);
+	}
+
+	stream_number(stream, magnitude, sign, 10, 0, 0, 0, precision, decimals);
+	stream_end(stream);
+}
 
-	tmp = (((displayX[0] - displayX[2]) * (touchY[1] - touchY[2])) - ((displayX[1] - displayX[2])*(touchY[0] - touchY[2])));
-	TransMatrix[0] = ((int64_t)tmp << 16) / k;
 
-	tmp = (((touchX[0] - touchX[2]) * (displayX[1] - displayX[2])) - ((displayX[0] - displayX[2])*(touchX[1] - touchX[2])));
-	TransMatrix[1] = ((int64_t)tmp << 16) / k;
+#if !defined (EVE_BURST_ONLY)
+
+#if EVE_GEN < 3
+/* write a string to the command-fifo with the arguments already converted by the host, for FT81x that do not have EVE_OPT_FORMAT */
+void private_format_write(const char *text, uint8_t num_args, va_list arguments)
+{
+	format_stream stream = {0, 0, 0, 0};
+	stream_format(&stream, text, num_args, arguments);
+}
+#endif
+
+void private_fixed_write(int32_t number, uint16_t options, uint8_t decimals)
+{
+	format_stream stream = {0, 0, 0, 0};
+	stream_fixed(&stream, number, options, decimals);
+}
 
-	tmp = ((touchY[0] * (((touchX[2] * displayX[1]) - (touchX[1] * displayX[2])))) + (touchY[1] * (((touchX[0] * displayX[2]) - (touchX[2] * displayX[0])))) + (touchY[2] * (((touchX[1] * displayX[0]) - (touchX[0] * displayX[1])))));
-	TransMatrix[2] = ((int64_t)tmp << 16) / k;
+#endif /* EVE_BURST_ONLY */
 
-	tmp = (((displayY[0] - displayY[2]) * (touchY[1] - touchY[2])) - ((displayY[1] - displayY[2])*(touchY[0] - touchY[2])));
-	TransMatrix[3] = ((int64_t)tmp << 16) / k;
 
-	tmp = (((touchX[0] - touchX[2]) * (displayY[1] - displayY[2])) - ((displayY[0] - displayY[2])*(touchX[1] - touchX[2])));
-	TransMatrix[4] = ((int64_t)tmp << 16) / k;
+#if !defined (EVE_NO_BURST)
 
-	tmp = ((touchY[0] * (((touchX[2] * displayY[1]) - (touchX[1] * displayY[2])))) + (touchY[1] * (((touchX[0] * displayY[2]) - (touchX[2] * displayY[0])))) + (touchY[2] * (((touchX[1] * displayY[0]) - (touchX[0] * displayY[1])))));
-	TransMatrix[5] = ((int64_t)tmp << 16) / k;
+#if EVE_GEN < 3
+void private_format_write_burst(const char *text, uint8_t num_args, va_list arguments)
+{
+	format_stream stream = {0, 0, 0, 1};
+	stream_format(&stream, text, num_args, arguments);
+}
+#endif
 
-	EVE_memWrite32(REG_TOUCH_TRANSFORM_A, TransMatrix[0]);
-	EVE_memWrite32(REG_TOUCH_TRANSFORM_B, TransMatrix[1]);
-	EVE_memWrite32(REG_TOUCH_TRANSFORM_C, TransMatrix[2]);
-	EVE_memWrite32(REG_TOUCH_TRANSFORM_D, TransMatrix[3]);
-	EVE_memWrite32(REG_TOUCH_TRANSFORM_E, TransMatrix[4]);
-	EVE_memWrite32(REG_TOUCH_TRANSFORM_F, TransMatrix[5]);
+void private_fixed_write_burst(int32_t number, uint16_t options, uint8_t decimals)
+{
+	format_stream stream = {0, 0, 0, 1};
+	stream_fixed(&stream, number, options, decimals);
 }
+
+#endif /* EVE_NO_BURST */
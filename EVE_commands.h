@@ -78,6 +78,16 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 - added prototypes for EVE_cmd_runanim(), EVE_cmd_runanim_burst()
 - added prototype for EVE_cmd_wait()
 - removed the history from before 4.0
+- removed the stale prototype for EVE_cmd_newlist_burst() and moved EVE_cmd_newlist() to the commands that are not used in display-lists
+- split the display-list prototypes into the non-burst and the _burst family, these can be left out with EVE_BURST_ONLY or EVE_NO_BURST
+- added prototypes for EVE_pack_string(), EVE_cmd_text_len(), EVE_cmd_text_len_burst(), EVE_cmd_text_packed() and EVE_cmd_text_packed_burst()
+- moved the prototypes for the _var functions out of the BT81x section as these work with FT81x now as well
+- added prototypes for EVE_cmd_number_fixed() and EVE_cmd_number_fixed_burst()
+- re-enabled the prototype for EVE_cmd_memwrite()
+- added prototypes for EVE_cmd_memwrite_burst() and EVE_cmd_memwrite32_burst()
+- added prototypes for EVE_init_splash(), EVE_init_finish() and EVE_get_first_pixel_us()
+- added prototypes for EVE_warm_mark() and EVE_init_warm()
+- moved the prototypes for EVE_cmd_calibrate(), EVE_cmd_calibratesub(), EVE_cmd_getmatrix() and EVE_calibrate_manual() out of the EVE_BURST_ONLY block
 
 */
 
@@ -103,6 +113,7 @@ void EVE_memWrite32(uint32_t ftAddress, uint32_t ftData32);
 void EVE_memWrite_flash_buffer(uint32_t ftAddress, const uint8_t *data, uint32_t len);
 void EVE_memWrite_sram_buffer(uint32_t ftAddress, const uint8_t *data, uint32_t len);
 uint8_t EVE_busy(void);
+uint16_t EVE_pack_string(uint32_t *words, uint16_t max_words, const char *text);
 void EVE_cmd_start(void);
 void EVE_cmd_execute(void);
 
@@ -115,11 +126,13 @@ void EVE_cmd_execute(void);
 /* EVE4: BT817 / BT818 */
 #if EVE_GEN > 3
 
+void EVE_cmd_calibratesub(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height);
 void EVE_cmd_flashprogram(uint32_t dest, uint32_t src, uint32_t num);
 void EVE_cmd_fontcache(uint32_t font, int32_t ptr, uint32_t num);
 void EVE_cmd_fontcachequery(uint32_t *total, int32_t *used);
 void EVE_cmd_getimage(uint32_t *source, uint32_t *fmt, uint32_t *width, uint32_t *height, uint32_t *palette);
 void EVE_cmd_linetime(uint32_t dest);
+void EVE_cmd_newlist(uint32_t adr);
 uint32_t EVE_cmd_pclkfreq(uint32_t ftarget, int32_t rounding);
 void EVE_cmd_wait(uint32_t us);
 
@@ -146,6 +159,8 @@ void EVE_cmd_inflate2(uint32_t ptr, uint32_t options, const uint8_t *data, uint3
 #endif /* EVE_GEN > 2 */
 
 
+void EVE_cmd_calibrate(void);
+void EVE_cmd_getmatrix(int32_t *get_a, int32_t *get_b, int32_t *get_c, int32_t *get_d, int32_t *get_e, int32_t *get_f);
 void EVE_cmd_getprops(uint32_t *pointer, uint32_t *width, uint32_t *height);
 uint32_t EVE_cmd_getptr(void);
 void EVE_cmd_inflate(uint32_t ptr, const uint8_t *data, uint32_t len);
@@ -155,7 +170,7 @@ void EVE_cmd_mediafifo(uint32_t ptr, uint32_t size);
 void EVE_cmd_memcpy(uint32_t dest, uint32_t src, uint32_t num);
 uint32_t EVE_cmd_memcrc(uint32_t ptr, uint32_t num);
 void EVE_cmd_memset(uint32_t ptr, uint8_t value, uint32_t num);
-/*(void EVE_cmd_memwrite(uint32_t dest, uint32_t num, const uint8_t *data); */
+void EVE_cmd_memwrite(uint32_t dest, uint32_t num, const uint8_t *data);
 void EVE_cmd_memzero(uint32_t ptr, uint32_t num);
 void EVE_cmd_playvideo(uint32_t options, const uint8_t *data, uint32_t len);
 uint32_t EVE_cmd_regread(uint32_t ptr);
@@ -177,6 +192,15 @@ uint8_t EVE_init_flash(void);
 #endif /* EVE_GEN > 2 */
 
 uint8_t EVE_init(void);
+uint8_t EVE_init_splash(const uint32_t *list, uint16_t words);
+void EVE_init_finish(void);
+uint32_t EVE_get_first_pixel_us(void);
+
+#define EVE_INIT_COLD 1U
+#define EVE_INIT_WARM 2U
+
+void EVE_warm_mark(uint32_t signature, uint32_t start, uint32_t size);
+uint8_t EVE_init_warm(uint32_t signature);
 
 
 /*----------------------------------------------------------------------------------------------------------------------------*/
@@ -187,27 +211,18 @@ void EVE_start_cmd_burst(void);
 void EVE_end_cmd_burst(void);
 
 
-
+/* display-list commands, executed right away when called outside EVE_start_cmd_burst() / EVE_end_cmd_burst() */
+#if !defined (EVE_BURST_ONLY)
 
 /* EVE4: BT817 / BT818 */
 #if EVE_GEN > 3
 
 void EVE_cmd_animframeram(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame);
-void EVE_cmd_animframeram_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame);
 void EVE_cmd_animstartram(int32_t ch, uint32_t aoptr, uint32_t loop);
-void EVE_cmd_animstartram_burst(int32_t ch, uint32_t aoptr, uint32_t loop);
 void EVE_cmd_apilevel(uint32_t level);
-void EVE_cmd_apilevel_burst(uint32_t level);
-void EVE_cmd_calibratesub(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height);
 void EVE_cmd_calllist(uint32_t adr);
-void EVE_cmd_calllist_burst(uint32_t adr);
 void EVE_cmd_hsf(uint32_t hsf);
-void EVE_cmd_hsf_burst(uint32_t hsf);
-void EVE_cmd_newlist(uint32_t adr);
-void EVE_cmd_newlist_burst(uint32_t adr);
 void EVE_cmd_runanim(uint32_t waitmask, uint32_t play);
-void EVE_cmd_runanim_burst(uint32_t waitmask, uint32_t play);
-
 
 #endif /* EVE_GEN > 3 */
 
@@ -216,99 +231,137 @@ void EVE_cmd_runanim_burst(uint32_t waitmask, uint32_t play);
 #if EVE_GEN > 2
 
 void EVE_cmd_animdraw(int32_t ch);
-void EVE_cmd_animdraw_burst(int32_t ch);
 void EVE_cmd_animframe(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame);
-void EVE_cmd_animframe_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame);
 void EVE_cmd_animstart(int32_t ch, uint32_t aoptr, uint32_t loop);
-void EVE_cmd_animstart_burst(int32_t ch, uint32_t aoptr, uint32_t loop);
 void EVE_cmd_animstop(int32_t ch);
-void EVE_cmd_animstop_burst(int32_t ch);
 void EVE_cmd_animxy(int32_t ch, int16_t x0, int16_t y0);
-void EVE_cmd_animxy_burst(int32_t ch, int16_t x0, int16_t y0);
 void EVE_cmd_appendf(uint32_t ptr, uint32_t num);
-void EVE_cmd_appendf_burst(uint32_t ptr, uint32_t num);
 uint16_t EVE_cmd_bitmap_transform( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2);
-void EVE_cmd_bitmap_transform_burst( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2);
 void EVE_cmd_fillwidth(uint32_t s);
-void EVE_cmd_fillwidth_burst(uint32_t s);
 void EVE_cmd_gradienta(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1);
-void EVE_cmd_gradienta_burst(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1);
 void EVE_cmd_rotatearound(int32_t x0, int32_t y0, int32_t angle, int32_t scale);
-void EVE_cmd_rotatearound_burst(int32_t x0, int32_t y0, int32_t angle, int32_t scale);
+
+#endif /* EVE_GEN > 2 */
+
 
 void EVE_cmd_button_var(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...);
-void EVE_cmd_button_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...);
 void EVE_cmd_text_var(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t numargs, ...);
-void EVE_cmd_text_var_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t numargs, ...);
 void EVE_cmd_toggle_var(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...);
-void EVE_cmd_toggle_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...);
+
+void EVE_cmd_dl(uint32_t command);
+
+void EVE_cmd_append(uint32_t ptr, uint32_t num);
+void EVE_cmd_bgcolor(uint32_t color);
+void EVE_cmd_button(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text);
+void EVE_cmd_clock(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs);
+void EVE_cmd_dial(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val);
+void EVE_cmd_fgcolor(uint32_t color);
+void EVE_cmd_gauge(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range);
+void EVE_cmd_gradcolor(uint32_t color);
+void EVE_cmd_gradient(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1);
+void EVE_cmd_keys(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text);
+void EVE_cmd_number(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number);
+void EVE_cmd_number_fixed(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number, uint8_t decimals);
+void EVE_cmd_progress(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range);
+void EVE_cmd_romfont(uint32_t font, uint32_t romslot);
+void EVE_cmd_rotate(int32_t angle);
+void EVE_cmd_scale(int32_t sx, int32_t sy);
+void EVE_cmd_scrollbar(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range);
+void EVE_cmd_setbase(uint32_t base);
+void EVE_cmd_setbitmap(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height);
+void EVE_cmd_setfont(uint32_t font, uint32_t ptr);
+void EVE_cmd_setfont2(uint32_t font, uint32_t ptr, uint32_t firstchar);
+void EVE_cmd_setscratch(uint32_t handle);
+void EVE_cmd_sketch(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format);
+void EVE_cmd_slider(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range);
+void EVE_cmd_spinner(int16_t x0, int16_t y0, uint16_t style, uint16_t scale);
+void EVE_cmd_text(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text);
+void EVE_cmd_text_len(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint32_t length);
+void EVE_cmd_text_packed(int16_t x0, int16_t y0, int16_t font, uint16_t options, const uint32_t *words, uint16_t num);
+void EVE_cmd_toggle(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text);
+void EVE_cmd_translate(int32_t tx, int32_t ty);
+
+void EVE_color_rgb(uint32_t color);
+
+#endif /* EVE_BURST_ONLY */
+
+
+/* display-list commands for use between EVE_start_cmd_burst() and EVE_end_cmd_burst() only */
+#if !defined (EVE_NO_BURST)
+
+/* EVE4: BT817 / BT818 */
+#if EVE_GEN > 3
+
+void EVE_cmd_animframeram_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame);
+void EVE_cmd_animstartram_burst(int32_t ch, uint32_t aoptr, uint32_t loop);
+void EVE_cmd_apilevel_burst(uint32_t level);
+void EVE_cmd_calllist_burst(uint32_t adr);
+void EVE_cmd_hsf_burst(uint32_t hsf);
+void EVE_cmd_runanim_burst(uint32_t waitmask, uint32_t play);
+
+#endif /* EVE_GEN > 3 */
+
+
+/* EVE3: BT815 / BT816 */
+#if EVE_GEN > 2
+
+void EVE_cmd_animdraw_burst(int32_t ch);
+void EVE_cmd_animframe_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame);
+void EVE_cmd_animstart_burst(int32_t ch, uint32_t aoptr, uint32_t loop);
+void EVE_cmd_animstop_burst(int32_t ch);
+void EVE_cmd_animxy_burst(int32_t ch, int16_t x0, int16_t y0);
+void EVE_cmd_appendf_burst(uint32_t ptr, uint32_t num);
+void EVE_cmd_bitmap_transform_burst( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2);
+void EVE_cmd_fillwidth_burst(uint32_t s);
+void EVE_cmd_gradienta_burst(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1);
+void EVE_cmd_rotatearound_burst(int32_t x0, int32_t y0, int32_t angle, int32_t scale);
 
 #endif /* EVE_GEN > 2 */
 
 
-void EVE_cmd_dl(uint32_t command);
+void EVE_cmd_button_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...);
+void EVE_cmd_text_var_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t numargs, ...);
+void EVE_cmd_toggle_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...);
+
 void EVE_cmd_dl_burst(uint32_t command);
 
-void EVE_cmd_append(uint32_t ptr, uint32_t num);
 void EVE_cmd_append_burst(uint32_t ptr, uint32_t num);
-void EVE_cmd_bgcolor(uint32_t color);
 void EVE_cmd_bgcolor_burst(uint32_t color);
-void EVE_cmd_button(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text);
 void EVE_cmd_button_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text);
-void EVE_cmd_calibrate(void);
-void EVE_cmd_clock(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs);
 void EVE_cmd_clock_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs);
-void EVE_cmd_dial(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val);
 void EVE_cmd_dial_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val);
-void EVE_cmd_fgcolor(uint32_t color);
 void EVE_cmd_fgcolor_burst(uint32_t color);
-void EVE_cmd_gauge(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range);
 void EVE_cmd_gauge_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range);
-void EVE_cmd_getmatrix(int32_t *get_a, int32_t *get_b, int32_t *get_c, int32_t *get_d, int32_t *get_e, int32_t *get_f);
-void EVE_cmd_gradcolor(uint32_t color);
 void EVE_cmd_gradcolor_burst(uint32_t color);
-void EVE_cmd_gradient(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1);
 void EVE_cmd_gradient_burst(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1);
-void EVE_cmd_keys(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text);
 void EVE_cmd_keys_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text);
-void EVE_cmd_number(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number);
+void EVE_cmd_memwrite_burst(uint32_t dest, uint32_t num, const uint8_t *data);
+void EVE_cmd_memwrite32_burst(uint32_t dest, uint32_t data);
 void EVE_cmd_number_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number);
-void EVE_cmd_progress(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range);
+void EVE_cmd_number_fixed_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number, uint8_t decimals);
 void EVE_cmd_progress_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range);
-void EVE_cmd_romfont(uint32_t font, uint32_t romslot);
 void EVE_cmd_romfont_burst(uint32_t font, uint32_t romslot);
-void EVE_cmd_rotate(int32_t angle);
 void EVE_cmd_rotate_burst(int32_t angle);
-void EVE_cmd_scale(int32_t sx, int32_t sy);
 void EVE_cmd_scale_burst(int32_t sx, int32_t sy);
-void EVE_cmd_scrollbar(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range);
 void EVE_cmd_scrollbar_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range);
-void EVE_cmd_setbase(uint32_t base);
 void EVE_cmd_setbase_burst(uint32_t base);
-void EVE_cmd_setbitmap(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height);
 void EVE_cmd_setbitmap_burst(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height);
-void EVE_cmd_setfont(uint32_t font, uint32_t ptr);
 void EVE_cmd_setfont_burst(uint32_t font, uint32_t ptr);
-void EVE_cmd_setfont2(uint32_t font, uint32_t ptr, uint32_t firstchar);
 void EVE_cmd_setfont2_burst(uint32_t font, uint32_t ptr, uint32_t firstchar);
-void EVE_cmd_setscratch(uint32_t handle);
 void EVE_cmd_setscratch_burst(uint32_t handle);
-void EVE_cmd_sketch(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format);
 void EVE_cmd_sketch_burst(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format);
-void EVE_cmd_slider(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range);
 void EVE_cmd_slider_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range);
-void EVE_cmd_spinner(int16_t x0, int16_t y0, uint16_t style, uint16_t scale);
 void EVE_cmd_spinner_burst(int16_t x0, int16_t y0, uint16_t style, uint16_t scale);
-void EVE_cmd_text(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text);
 void EVE_cmd_text_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text);
-void EVE_cmd_toggle(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text);
+void EVE_cmd_text_len_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint32_t length);
+void EVE_cmd_text_packed_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const uint32_t *words, uint16_t num);
 void EVE_cmd_toggle_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text);
-void EVE_cmd_translate(int32_t tx, int32_t ty);
 void EVE_cmd_translate_burst(int32_t tx, int32_t ty);
 
-void EVE_color_rgb(uint32_t color);
 void EVE_color_rgb_burst(uint32_t color);
 
+#endif /* EVE_NO_BURST */
+
 
 /*---------------------------------------------------------------------------------------------------------------------------*/
 /*-------- special purpose functions ------------------- --------------------------------------------------------------------*/
@@ -0,0 +1,631 @@
+/*
+@file    EVE_commands_burst.c
+@brief   contains FT8xx / BT8xx display-list functions for cmd-burst
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+These were split off from EVE_commands.c, these only put the command into the SPI stream or the DMA buffer
+and must only be used between EVE_start_cmd_burst() and EVE_end_cmd_burst().
+Define EVE_NO_BURST to leave these out of the build.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+@section History
+
+5.0
+- split off from EVE_commands.c
+- added EVE_cmd_text_len_burst() and EVE_cmd_text_packed_burst()
+- the _var_burst functions are available for FT81x as well now, these convert the string on the host
+- added EVE_cmd_number_fixed_burst()
+- added EVE_cmd_memwrite_burst() and EVE_cmd_memwrite32_burst()
+
+*/
+
+#include "EVE.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+#include <stdarg.h>
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*-------- functions for display lists in cmd-burst -------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+
+/* BT817 / BT818 */
+#if EVE_GEN > 3
+
+void EVE_cmd_animframeram_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
+{
+	spi_transmit_burst(CMD_ANIMFRAMERAM);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst(aoptr);
+	spi_transmit_burst(frame);
+}
+
+
+void EVE_cmd_animstartram_burst(int32_t ch, uint32_t aoptr, uint32_t loop)
+{
+	spi_transmit_burst(CMD_ANIMSTARTRAM);
+	spi_transmit_burst(ch);
+	spi_transmit_burst(aoptr);
+	spi_transmit_burst(loop);
+}
+
+
+void EVE_cmd_apilevel_burst(uint32_t level)
+{
+	spi_transmit_burst(CMD_APILEVEL);
+	spi_transmit_burst(level);
+}
+
+
+void EVE_cmd_calllist_burst(uint32_t adr)
+{
+	spi_transmit_burst(CMD_CALLLIST);
+	spi_transmit_burst(adr);
+}
+
+
+void EVE_cmd_hsf_burst(uint32_t hsf)
+{
+	spi_transmit_burst(CMD_HSF);
+	spi_transmit_burst(hsf);
+}
+
+
+void EVE_cmd_runanim_burst(uint32_t waitmask, uint32_t play)
+{
+	spi_transmit_burst(CMD_RUNANIM);
+	spi_transmit_burst(waitmask);
+	spi_transmit_burst(play);
+}
+
+
+#endif /* EVE_GEN > 3 */
+
+
+/* BT815 / BT816 */
+#if EVE_GEN > 2
+
+void EVE_cmd_animdraw_burst(int32_t ch)
+{
+	spi_transmit_burst(CMD_ANIMDRAW);
+	spi_transmit_burst(ch);
+}
+
+
+void EVE_cmd_animframe_burst(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
+{
+	spi_transmit_burst(CMD_ANIMFRAME);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst(aoptr);
+	spi_transmit_burst(frame);
+}
+
+
+void EVE_cmd_animstart_burst(int32_t ch, uint32_t aoptr, uint32_t loop)
+{
+	spi_transmit_burst(CMD_ANIMSTART);
+	spi_transmit_burst(ch);
+	spi_transmit_burst(aoptr);
+	spi_transmit_burst(loop);
+}
+
+
+void EVE_cmd_animstop_burst(int32_t ch)
+{
+	spi_transmit_burst(CMD_ANIMSTOP);
+	spi_transmit_burst(ch);
+}
+
+
+void EVE_cmd_animxy_burst(int32_t ch, int16_t x0, int16_t y0)
+{
+	spi_transmit_burst(CMD_ANIMXY);
+	spi_transmit_burst(ch);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+}
+
+
+void EVE_cmd_appendf_burst(uint32_t ptr, uint32_t num)
+{
+	spi_transmit_burst(CMD_APPENDF);
+	spi_transmit_burst(ptr);
+	spi_transmit_burst(num);
+}
+
+
+/* note: as this is meant for use in burst-mode display-list generation the result parameter is ignored */
+void EVE_cmd_bitmap_transform_burst( int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2)
+{
+	spi_transmit_burst(CMD_BITMAP_TRANSFORM);
+	spi_transmit_burst(x0);
+	spi_transmit_burst(y0);
+	spi_transmit_burst(x1);
+	spi_transmit_burst(y1);
+	spi_transmit_burst(x2);
+	spi_transmit_burst(y2);
+	spi_transmit_burst(tx0);
+	spi_transmit_burst(ty0);
+	spi_transmit_burst(tx1);
+	spi_transmit_burst(ty1);
+	spi_transmit_burst(tx2);
+	spi_transmit_burst(ty2);
+	spi_transmit_burst(0);
+}
+
+
+void EVE_cmd_fillwidth_burst(uint32_t s)
+{
+	spi_transmit_burst(CMD_FILLWIDTH);
+	spi_transmit_burst(s);
+}
+
+
+void EVE_cmd_gradienta_burst(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1)
+{
+	spi_transmit_burst(CMD_GRADIENTA);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst(argb0);
+	spi_transmit_burst((uint32_t) x1 + ((uint32_t) y1 << 16));
+	spi_transmit_burst(argb1);
+}
+
+
+void EVE_cmd_rotatearound_burst(int32_t x0, int32_t y0, int32_t angle, int32_t scale)
+{
+	spi_transmit_burst(CMD_ROTATEAROUND);
+	spi_transmit_burst(x0);
+	spi_transmit_burst(y0);
+	spi_transmit_burst(angle);
+	spi_transmit_burst(scale);
+}
+
+
+#endif /* EVE_GEN > 2 */
+
+
+void EVE_cmd_button_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
+{
+	va_list arguments;
+
+	va_start(arguments, num_args);
+	spi_transmit_burst(CMD_BUTTON);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+
+#if EVE_GEN > 2
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	private_string_write_burst(text);
+
+	if(options & EVE_OPT_FORMAT)
+	{
+		uint8_t counter;
+
+		for(counter=0;counter<num_args;counter++)
+		{
+			spi_transmit_burst((uint32_t) va_arg(arguments, int));
+		}
+	}
+#else
+	spi_transmit_burst((uint32_t) font + ((uint32_t) (options & ~EVE_OPT_FORMAT) << 16));
+
+	if(options & EVE_OPT_FORMAT)
+	{
+		private_format_write_burst(text, num_args, arguments);
+	}
+	else
+	{
+		private_string_write_burst(text);
+	}
+#endif
+
+	va_end(arguments);
+}
+
+
+void EVE_cmd_text_var_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
+{
+	va_list arguments;
+
+	va_start(arguments, num_args);
+	spi_transmit_burst(CMD_TEXT);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+
+#if EVE_GEN > 2
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	private_string_write_burst(text);
+
+	if(options & EVE_OPT_FORMAT)
+	{
+		uint8_t counter;
+
+		for(counter=0;counter<num_args;counter++)
+		{
+			spi_transmit_burst((uint32_t) va_arg(arguments, int));
+		}
+	}
+#else
+	spi_transmit_burst((uint32_t) font + ((uint32_t) (options & ~EVE_OPT_FORMAT) << 16));
+
+	if(options & EVE_OPT_FORMAT)
+	{
+		private_format_write_burst(text, num_args, arguments);
+	}
+	else
+	{
+		private_string_write_burst(text);
+	}
+#endif
+
+	va_end(arguments);
+}
+
+
+void EVE_cmd_toggle_var_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...)
+{
+	va_list arguments;
+
+	va_start(arguments, num_args);
+	spi_transmit_burst(CMD_TOGGLE);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) font << 16));
+
+#if EVE_GEN > 2
+	spi_transmit_burst((uint32_t) options + ((uint32_t) state << 16));
+	private_string_write_burst(text);
+
+	if(options & EVE_OPT_FORMAT)
+	{
+		uint8_t counter;
+
+		for(counter=0;counter<num_args;counter++)
+		{
+			spi_transmit_burst((uint32_t) va_arg(arguments, int));
+		}
+	}
+#else
+	spi_transmit_burst((uint32_t) (options & ~EVE_OPT_FORMAT) + ((uint32_t) state << 16));
+
+	if(options & EVE_OPT_FORMAT)
+	{
+		private_format_write_burst(text, num_args, arguments);
+	}
+	else
+	{
+		private_string_write_burst(text);
+	}
+#endif
+
+	va_end(arguments);
+}
+
+
+
+void EVE_cmd_dl_burst(uint32_t command)
+{
+	spi_transmit_burst(command);
+}
+
+
+void EVE_cmd_append_burst(uint32_t ptr, uint32_t num)
+{
+	spi_transmit_burst(CMD_APPEND);
+	spi_transmit_burst(ptr);
+	spi_transmit_burst(num);
+}
+
+
+void EVE_cmd_bgcolor_burst(uint32_t color)
+{
+	spi_transmit_burst(CMD_BGCOLOR);
+	spi_transmit_burst(color);
+}
+
+
+void EVE_cmd_button_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
+{
+	spi_transmit_burst(CMD_BUTTON);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	private_string_write_burst(text);
+}
+
+
+void EVE_cmd_clock_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs)
+{
+	spi_transmit_burst(CMD_CLOCK);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) r0 + ((uint32_t) options << 16));
+	spi_transmit_burst((uint32_t) hours + ((uint32_t) minutes << 16));
+	spi_transmit_burst((uint32_t) seconds + ((uint32_t) millisecs << 16));
+}
+
+
+void EVE_cmd_dial_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val)
+{
+	spi_transmit_burst(CMD_DIAL);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) r0 + ((uint32_t) options << 16));
+	spi_transmit_burst(val);
+}
+
+
+void EVE_cmd_fgcolor_burst(uint32_t color)
+{
+	spi_transmit_burst(CMD_FGCOLOR);
+	spi_transmit_burst(color);
+}
+
+
+void EVE_cmd_gauge_burst(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range)
+{
+	spi_transmit_burst(CMD_GAUGE);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) r0 + ((uint32_t) options << 16));
+	spi_transmit_burst((uint32_t) major + ((uint32_t) minor << 16));
+	spi_transmit_burst((uint32_t) val + ((uint32_t) range << 16));
+}
+
+
+void EVE_cmd_gradcolor_burst(uint32_t color)
+{
+	spi_transmit_burst(CMD_GRADCOLOR);
+	spi_transmit_burst(color);
+}
+
+
+void EVE_cmd_gradient_burst(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1)
+{
+	spi_transmit_burst(CMD_GRADIENT);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst(rgb0);
+	spi_transmit_burst((uint32_t) x1 + ((uint32_t) y1 << 16));
+	spi_transmit_burst(rgb1);
+}
+
+
+void EVE_cmd_keys_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
+{
+	spi_transmit_burst(CMD_KEYS);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+
+	private_string_write_burst(text);
+}
+
+
+/* writes to RAM_G or a register as part of the command stream, in order with the commands around it */
+/* the data is padded to a multiple of four bytes, keep it small as it has to fit into the command-fifo / DMA buffer with the rest of the burst */
+/* "data" is read with fetch_flash_byte() so it can be in flash on AVR */
+void EVE_cmd_memwrite_burst(uint32_t dest, uint32_t num, const uint8_t *data)
+{
+	spi_transmit_burst(CMD_MEMWRITE);
+	spi_transmit_burst(dest);
+	spi_transmit_burst(num);
+	private_block_write_burst(data, num);
+}
+
+
+/* writes a single 32 bit value, for example EVE_cmd_memwrite32_burst(REG_PWM_DUTY, 64) to change the backlight with the next frame */
+void EVE_cmd_memwrite32_burst(uint32_t dest, uint32_t data)
+{
+	spi_transmit_burst(CMD_MEMWRITE);
+	spi_transmit_burst(dest);
+	spi_transmit_burst(4);
+	spi_transmit_burst(data);
+}
+
+
+void EVE_cmd_number_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number)
+{
+	spi_transmit_burst(CMD_NUMBER);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	spi_transmit_burst(number);
+}
+
+
+void EVE_cmd_number_fixed_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number, uint8_t decimals)
+{
+	if(decimals > 254U)
+	{
+		decimals = 254U;
+	}
+
+	spi_transmit_burst(CMD_TEXT);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) (options & 0xfe00U) << 16));
+	private_fixed_write_burst(number, options, decimals);
+}
+
+
+void EVE_cmd_progress_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
+{
+	spi_transmit_burst(CMD_PROGRESS);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+	spi_transmit_burst((uint32_t) options + ((uint32_t) val << 16));
+	spi_transmit_burst(range);
+}
+
+
+void EVE_cmd_romfont_burst(uint32_t font, uint32_t romslot)
+{
+	spi_transmit_burst(CMD_ROMFONT);
+	spi_transmit_burst(font);
+	spi_transmit_burst(romslot);
+}
+
+
+void EVE_cmd_rotate_burst(int32_t angle)
+{
+	spi_transmit_burst(CMD_ROTATE);
+	spi_transmit_burst(angle);
+}
+
+
+void EVE_cmd_scale_burst(int32_t sx, int32_t sy)
+{
+	spi_transmit_burst(CMD_SCALE);
+	spi_transmit_burst(sx);
+	spi_transmit_burst(sy);
+}
+
+
+void EVE_cmd_scrollbar_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range)
+{
+	spi_transmit_burst(CMD_SCROLLBAR);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+	spi_transmit_burst((uint32_t) options + ((uint32_t) val << 16));
+	spi_transmit_burst((uint32_t) size + ((uint32_t) range << 16));
+}
+
+
+void EVE_cmd_setbase_burst(uint32_t base)
+{
+	spi_transmit_burst(CMD_SETBASE);
+	spi_transmit_burst(base);
+}
+
+
+void EVE_cmd_setbitmap_burst(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height)
+{
+	spi_transmit_burst(CMD_SETBITMAP);
+	spi_transmit_burst(addr);
+	spi_transmit_burst((uint32_t) fmt + ((uint32_t) width << 16));
+	spi_transmit_burst(height);
+}
+
+
+void EVE_cmd_setfont_burst(uint32_t font, uint32_t ptr)
+{
+	spi_transmit_burst(CMD_SETFONT);
+	spi_transmit_burst(font);
+	spi_transmit_burst(ptr);
+}
+
+
+void EVE_cmd_setfont2_burst(uint32_t font, uint32_t ptr, uint32_t firstchar)
+{
+	spi_transmit_burst(CMD_SETFONT2);
+	spi_transmit_burst(font);
+	spi_transmit_burst(ptr);
+	spi_transmit_burst(firstchar);
+}
+
+
+void EVE_cmd_setscratch_burst(uint32_t handle)
+{
+	spi_transmit_burst(CMD_SETSCRATCH);
+	spi_transmit_burst(handle);
+}
+
+
+void EVE_cmd_sketch_burst(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format)
+{
+	spi_transmit_burst(CMD_SKETCH);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+	spi_transmit_burst(ptr);
+	spi_transmit_burst(format);
+}
+
+
+void EVE_cmd_slider_burst(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
+{
+	spi_transmit_burst(CMD_SLIDER);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) h0 << 16));
+	spi_transmit_burst((uint32_t) options + ((uint32_t) val << 16));
+	spi_transmit_burst(range);
+}
+
+
+void EVE_cmd_spinner_burst(int16_t x0, int16_t y0, uint16_t style, uint16_t scale)
+{
+	spi_transmit_burst(CMD_SPINNER);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) style + ((uint32_t) scale << 16));
+}
+
+
+void EVE_cmd_text_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text)
+{
+	spi_transmit_burst(CMD_TEXT);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	private_string_write_burst(text);
+}
+
+
+/* same as EVE_cmd_text_burst() but for a string with a known length that does not need to be zero-terminated */
+void EVE_cmd_text_len_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint32_t length)
+{
+	spi_transmit_burst(CMD_TEXT);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	private_string_write_len_burst(text, length);
+}
+
+
+/* same as EVE_cmd_text_burst() but for a string that was converted with EVE_pack_string() before */
+void EVE_cmd_text_packed_burst(int16_t x0, int16_t y0, int16_t font, uint16_t options, const uint32_t *words, uint16_t num)
+{
+	spi_transmit_burst(CMD_TEXT);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) font + ((uint32_t) options << 16));
+	private_words_write_burst(words, num);
+}
+
+
+void EVE_cmd_toggle_burst(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text)
+{
+	spi_transmit_burst(CMD_TOGGLE);
+	spi_transmit_burst((uint32_t) x0 + ((uint32_t) y0 << 16));
+	spi_transmit_burst((uint32_t) w0 + ((uint32_t) font << 16));
+	spi_transmit_burst((uint32_t) options + ((uint32_t) state << 16));
+	private_string_write_burst(text);
+}
+
+
+void EVE_cmd_translate_burst(int32_t tx, int32_t ty)
+{
+	spi_transmit_burst(CMD_TRANSLATE);
+	spi_transmit_burst(tx);
+	spi_transmit_burst(ty);
+}
+
+
+void EVE_color_rgb_burst(uint32_t color)
+{
+	spi_transmit_burst(DL_COLOR_RGB | color);
+}
+
+#endif /* EVE_NO_BURST */
@@ -0,0 +1,891 @@
+/*
+@file    EVE_commands_copro.c
+@brief   contains FT8xx / BT8xx co-processor commands that are not used in display-lists
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+These were split off from EVE_commands.c, all of these address the command-fifo directly, include execution
+and waiting for completion and do not support cmd-burst.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+@section History
+
+5.0
+- split off from EVE_commands.c
+- changed EVE_cmd_clearcache() to not depend on EVE_cmd_dl() anymore
+- re-enabled EVE_cmd_memwrite(), using block_transfer() for the data
+- moved EVE_cmd_calibrate(), EVE_cmd_calibratesub(), EVE_cmd_getmatrix() and EVE_calibrate_manual() over from EVE_commands_dl.c, EVE_calibrate_manual() uses the _burst functions with EVE_BURST_ONLY
+
+*/
+
+#include "EVE.h"
+#include "EVE_commands_private.h"
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- co-processor commands that are not used in displays lists, these are not to be used with burst transfers --------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+
+/* BT817 / BT818 */
+#if EVE_GEN > 3
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_calibratesub(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_CALIBRATESUB);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(width));
+		spi_transmit((uint8_t)(width >> 8));
+		spi_transmit((uint8_t)(height));
+		spi_transmit((uint8_t)(height >> 8));
+
+		EVE_cs_clear();
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* write "num" bytes from src in RAM_G to to the external flash on a BT81x board at address dest */
+/* note: dest must be 4096-byte aligned, src must be 4-byte aligned, num must be a multiple of 4096 */
+/* note: EVE will not do anything if the alignment requirements are not met */
+/* note: the address ptr is relative to the flash so the first address is 0x00000000 not 0x800000 */
+/* note: this looks exactly the same as EVE_cmd_flashupdate() but it needs the flash to be empty */
+void EVE_cmd_flashprogram(uint32_t dest, uint32_t src, uint32_t num)
+{
+	eve_begin_cmd(CMD_FLASHPROGRAM);
+	spi_transmit_32(dest);
+	spi_transmit_32(src);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_fontcache(uint32_t font, int32_t ptr, uint32_t num)
+{
+	eve_begin_cmd(CMD_FONTCACHE);
+	spi_transmit_32(font);
+	spi_transmit_32(ptr);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_fontcachequery(uint32_t *total, int32_t *used)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_FONTCACHEQUERY);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+
+	if(total)
+	{
+		*total = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
+	}
+	if(used)
+	{
+		*used = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_getimage(uint32_t *source, uint32_t *fmt, uint32_t *width, uint32_t *height, uint32_t *palette)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_GETIMAGE);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+
+	if(palette)
+	{
+		*palette = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
+	}
+	if(height)
+	{
+		*height = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
+	}
+	if(width)
+	{
+		*width = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 12) & 0xfff));
+	}
+	if(fmt)
+	{
+		*fmt = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 16) & 0xfff));
+	}
+	if(source)
+	{
+		*source = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 20) & 0xfff));
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_linetime(uint32_t dest)
+{
+	eve_begin_cmd(CMD_LINETIME);
+	spi_transmit_32(dest);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_newlist(uint32_t adr)
+{
+	eve_begin_cmd(CMD_NEWLIST);
+	spi_transmit_32(adr);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* This command sets REG_PCLK_FREQ to generate the closest possible frequency to the one requested. */
+/* Returns the frequency achieved or zero if no frequency was found. */
+uint32_t EVE_cmd_pclkfreq(uint32_t ftarget, int32_t rounding)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_PCLKFREQ);
+	spi_transmit_32(ftarget);
+	spi_transmit_32(rounding);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+	cmdoffset -= 4;
+	cmdoffset &= 0x0fff;
+	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_wait(uint32_t us)
+{
+	eve_begin_cmd(CMD_WAIT);
+	spi_transmit_32(us);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+#endif /* EVE_GEN > 3 */
+
+
+/* BT815 / BT816 */
+#if EVE_GEN > 2
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* this command clears the graphics systems flash cache and to do so it needs to be executed with empty display lists */
+/* note: looks like overkill to clear both display lists but this is taken from BRT sample code */
+void EVE_cmd_clearcache(void)
+{
+	eve_begin_cmd(CMD_DLSTART);
+	spi_transmit_32(CMD_SWAP);
+	EVE_cs_clear();
+	while (EVE_busy());
+
+	eve_begin_cmd(CMD_DLSTART);
+	spi_transmit_32(CMD_SWAP);
+	EVE_cs_clear();
+	while (EVE_busy());
+
+	eve_begin_cmd(CMD_CLEARCACHE);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHATTACH); followed by EVE_cmd_execute(); would work as well */
+void EVE_cmd_flashattach(void)
+{
+	eve_begin_cmd(CMD_FLASHATTACH);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHDETACH); followed by EVE_cmd_execute(); would work as well */
+void EVE_cmd_flashdetach(void)
+{
+	eve_begin_cmd(CMD_FLASHDETACH);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHERASE); followed by EVE_cmd_execute(); would work as well */
+void EVE_cmd_flasherase(void)
+{
+	eve_begin_cmd(CMD_FLASHERASE);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+uint32_t EVE_cmd_flashfast(void)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_FLASHFAST);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+	cmdoffset -= 4;
+	cmdoffset &= 0x0fff;
+	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* this is added for conveniance, using EVE_cmd_dl(CMD_FLASHSPIDESEL); followed by EVE_cmd_execute(); would work as well */
+void EVE_cmd_flashspidesel(void)
+{
+	eve_begin_cmd(CMD_FLASHSPIDESEL);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* write "num" bytes from src in the external flash on a BT81x board to dest in RAM_G */
+/* note: src must be 64-byte aligned, dest must be 4-byte aligned, num must be a multiple of 4 */
+/* note: EVE will not do anything if the alignment requirements are not met */
+/* note: the src pointer is relative to the flash so the first address is 0x00000000 not 0x800000 */
+void EVE_cmd_flashread(uint32_t dest, uint32_t src, uint32_t num)
+{
+	eve_begin_cmd(CMD_FLASHREAD);
+	spi_transmit_32(dest);
+	spi_transmit_32(src);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_flashsource(uint32_t ptr)
+{
+	eve_begin_cmd(CMD_FLASHSOURCE);
+	spi_transmit_32(ptr);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* write "num" bytes from the BT81x SPI interface dest in RAM_G */
+/* note: raw direct access, not really useful for anything */
+void EVE_cmd_flashspirx(uint32_t dest, uint32_t num)
+{
+	eve_begin_cmd(CMD_FLASHSPIRX);
+	spi_transmit_32(dest);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* write "num" bytes from *data to the BT81x SPI interface */
+/* note: raw direct access, not really useful for anything */
+void EVE_cmd_flashspitx(uint32_t num, const uint8_t *data)
+{
+	eve_begin_cmd(CMD_FLASHSPITX);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	block_transfer(data, num);
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* write "num" bytes from src in RAM_G to to the external flash on a BT81x board at address dest */
+/* note: dest must be 4096-byte aligned, src must be 4-byte aligned, num must be a multiple of 4096 */
+/* note: EVE will not do anything if the alignment requirements are not met */
+/* note: the address ptr is relative to the flash so the first address is 0x00000000 not 0x800000 */
+void EVE_cmd_flashupdate(uint32_t dest, uint32_t src, uint32_t num)
+{
+	eve_begin_cmd(CMD_FLASHUPDATE);
+	spi_transmit_32(dest);
+	spi_transmit_32(src);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* write "num" bytes from *data to the external flash on a BT81x board at address ptr */
+/* note: ptr must be 256 byte aligned, num must be a multiple of 256 */
+/* note: EVE will not do anything if the alignment requirements are not met */
+/* note: the address ptr is relative to the flash so the first address is 0x00000000 not 0x800000 */
+/* note: on AVR controllers this expects the data to be located in the controllers flash memory */
+void EVE_cmd_flashwrite(uint32_t ptr, uint32_t num, const uint8_t *data)
+{
+	eve_begin_cmd(CMD_FLASHWRITE);
+	spi_transmit_32(ptr);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	if(data)
+	{
+		block_transfer(data, num);
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_inflate2(uint32_t ptr, uint32_t options, const uint8_t *data, uint32_t len)
+{
+	eve_begin_cmd(CMD_INFLATE2);
+	spi_transmit_32(ptr);
+	spi_transmit_32(options);
+	EVE_cs_clear();
+
+	if(options == 0) /* direct data, not by Media-FIFO or Flash */
+	{
+		if(data)
+		{
+			block_transfer(data, len);
+		}
+	}
+}
+
+#endif /* EVE_GEN > 2 */
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_calibrate(void)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_CALIBRATE);
+		spi_transmit_32(0);
+		EVE_cs_clear();
+	}
+}
+
+
+/* this function is meant to be called  with display-list building, but it waits for completion */
+/* as this function returns values by writing to the command-fifo, it can not be used with cmd-burst */
+/* get the properties of the bitmap transform matrix and write the values to the variables that are supplied by pointers */
+void EVE_cmd_getmatrix(int32_t *get_a, int32_t *get_b, int32_t *get_c, int32_t *get_d, int32_t *get_e, int32_t *get_f)
+{
+	if(!cmd_burst)
+	{
+		uint16_t cmdoffset;
+
+		eve_begin_cmd(CMD_GETMATRIX);
+		spi_transmit_32(0);
+		spi_transmit_32(0);
+		spi_transmit_32(0);
+		spi_transmit_32(0);
+		spi_transmit_32(0);
+		spi_transmit_32(0);
+		EVE_cs_clear();
+		while (EVE_busy());
+		cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+
+		if(get_f)
+		{
+			*get_f = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
+		}
+		if(get_e)
+		{
+			*get_e = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
+		}
+		if(get_d)
+		{
+			*get_d = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 12) & 0xfff));
+		}
+		if(get_c)
+		{
+			*get_c = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 16) & 0xfff));
+		}
+		if(get_b)
+		{
+			*get_b = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 20) & 0xfff));
+		}
+		if(get_a)
+		{
+			*get_a = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 24) & 0xfff));
+		}
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* get the properties of an image after a CMD_LOADIMAGE operation and write the values to the variables that are supplied by pointers
+    uint32 pointer, width, height;
+     EVE_LIB_GetProps(&pointer, &width, &height);
+
+    uint32 width, height;
+     EVE_LIB_GetProps(0, &width, &height);
+*/
+void EVE_cmd_getprops(uint32_t *pointer, uint32_t *width, uint32_t *height)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_GETPROPS);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+
+	if(pointer)
+	{
+		*pointer = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 12) & 0xfff));
+	}
+	if(width)
+	{
+		*width = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 8) & 0xfff));
+	}
+	if(height)
+	{
+		*height = EVE_memRead32(EVE_RAM_CMD + ((cmdoffset - 4) & 0xfff));
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* address = EVE_cmd_getpr(); */
+uint32_t EVE_cmd_getptr(void)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_GETPTR);
+	spi_transmit_32(0);
+
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+	cmdoffset -= 4;
+	cmdoffset &= 0x0fff;
+	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_inflate(uint32_t ptr, const uint8_t *data, uint32_t len)
+{
+	eve_begin_cmd(CMD_INFLATE);
+	spi_transmit_32(ptr);
+	EVE_cs_clear();
+	if(data)
+	{
+		block_transfer(data, len);
+	}
+}
+
+
+/* this is meant to be called outside display-list building, does not support cmd-burst */
+void EVE_cmd_interrupt(uint32_t ms)
+{
+	eve_begin_cmd(CMD_INTERRUPT);
+	spi_transmit_32(ms);
+	EVE_cs_clear();
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_loadimage(uint32_t ptr, uint32_t options, const uint8_t *data, uint32_t len)
+{
+	eve_begin_cmd(CMD_LOADIMAGE);
+	spi_transmit_32(ptr);
+	spi_transmit_32(options);
+	EVE_cs_clear();
+
+#if EVE_GEN > 2
+	if( ((options & EVE_OPT_MEDIAFIFO) == 0) && ((options & EVE_OPT_FLASH) == 0) )/* direct data, neither by Media-FIFO or from Flash */
+#else
+	if((options & EVE_OPT_MEDIAFIFO) == 0) /* direct data, not by Media-FIFO */
+#endif
+	{
+		if(data)
+		{
+			block_transfer(data, len);
+		}
+	}
+}
+
+
+/* this is meant to be called outside display-list building, does not support cmd-burst */
+void EVE_cmd_mediafifo(uint32_t ptr, uint32_t size)
+{
+	eve_begin_cmd(CMD_MEDIAFIFO);
+	spi_transmit_32(ptr);
+	spi_transmit_32(size);
+	EVE_cs_clear();
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_memcpy(uint32_t dest, uint32_t src, uint32_t num)
+{
+	eve_begin_cmd(CMD_MEMCPY);
+	spi_transmit_32(dest);
+	spi_transmit_32(src);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* crc32 = EVE_cmd_memcrc(my_ptr_to_some_memory_region, some_amount_of_bytes); */
+uint32_t EVE_cmd_memcrc(uint32_t ptr, uint32_t num)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_MEMCRC);
+	spi_transmit_32(ptr);
+	spi_transmit_32(num);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+	cmdoffset -= 4;
+	cmdoffset &= 0x0fff;
+	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+}
+
+
+/* this is meant to be called outside display-list building, does not support cmd-burst */
+void EVE_cmd_memset(uint32_t ptr, uint8_t value, uint32_t num)
+{
+	eve_begin_cmd(CMD_MEMSET);
+	spi_transmit_32(ptr);
+	spi_transmit_32((uint32_t) value);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* outside of display-lists the EVE_memWrite* helper functions do the same with less overhead, */
+/* this is for writes that need to be in sequence with other co-processor commands, see EVE_cmd_memwrite_burst() as well */
+void EVE_cmd_memwrite(uint32_t dest, uint32_t num, const uint8_t *data)
+{
+	eve_begin_cmd(CMD_MEMWRITE);
+	spi_transmit_32(dest);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	if(data)
+	{
+		block_transfer(data, num);
+	}
+	while (EVE_busy());
+}
+
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_memzero(uint32_t ptr, uint32_t num)
+{
+	eve_begin_cmd(CMD_MEMZERO);
+	spi_transmit_32(ptr);
+	spi_transmit_32(num);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command, does not support cmd-burst */
+/* it does not wait for completion in order to allow the video to be paused or terminated by REG_PLAY_CONTROL */
+void EVE_cmd_playvideo(uint32_t options, const uint8_t *data, uint32_t len)
+{
+	eve_begin_cmd(CMD_PLAYVIDEO);
+	spi_transmit_32(options);
+	EVE_cs_clear();
+
+	#if EVE_GEN > 2
+	if( ((options & EVE_OPT_MEDIAFIFO) == 0) && ((options & EVE_OPT_FLASH) == 0) )/* direct data, neither by Media-FIFO or from Flash */
+	#else
+	if((options & EVE_OPT_MEDIAFIFO) == 0) /* direct data, not by Media-FIFO */
+	#endif
+	{
+		if(data)
+		{
+			block_transfer(data, len);
+		}
+	}
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+/* regvalue = EVE_cmd_regread(ptr); */
+/* this seems to be completely pointless, there is no real use for it outside a display-list since the register could be read directly */
+/* and for what purpose would this be implemented to be used in a display list?? */
+uint32_t EVE_cmd_regread(uint32_t ptr)
+{
+	uint16_t cmdoffset;
+
+	eve_begin_cmd(CMD_REGREAD);
+	spi_transmit_32(ptr);
+	spi_transmit_32(0);
+	EVE_cs_clear();
+	while (EVE_busy());
+	cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+	cmdoffset -= 4;
+	cmdoffset &= 0x0fff;
+	return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_setrotate(uint32_t r)
+{
+	eve_begin_cmd(CMD_SETROTATE);
+	spi_transmit_32(r);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_snapshot(uint32_t ptr)
+{
+	eve_begin_cmd(CMD_SNAPSHOT);
+	spi_transmit_32(ptr);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_snapshot2(uint32_t fmt, uint32_t ptr, int16_t x0, int16_t y0, int16_t w0, int16_t h0)
+{
+	eve_begin_cmd(CMD_SNAPSHOT2);
+	spi_transmit_32(fmt);
+	spi_transmit_32(ptr);
+
+	spi_transmit((uint8_t)(x0));
+	spi_transmit((uint8_t)(x0 >> 8));
+	spi_transmit((uint8_t)(y0));
+	spi_transmit((uint8_t)(y0 >> 8));
+
+	spi_transmit((uint8_t)(w0));
+	spi_transmit((uint8_t)(w0 >> 8));
+	spi_transmit((uint8_t)(h0));
+	spi_transmit((uint8_t)(h0 >> 8));
+
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_track(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t tag)
+{
+	eve_begin_cmd(CMD_TRACK);
+
+	spi_transmit((uint8_t)(x0));
+	spi_transmit((uint8_t)(x0 >> 8));
+	spi_transmit((uint8_t)(y0));
+	spi_transmit((uint8_t)(y0 >> 8));
+
+	spi_transmit((uint8_t)(w0));
+	spi_transmit((uint8_t)(w0 >> 8));
+	spi_transmit((uint8_t)(h0));
+	spi_transmit((uint8_t)(h0 >> 8));
+
+	spi_transmit((uint8_t)(tag));
+	spi_transmit((uint8_t)(tag >> 8));
+	spi_transmit(0);
+	spi_transmit(0);
+
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/* this is meant to be called outside display-list building, it includes executing the command and waiting for completion, does not support cmd-burst */
+void EVE_cmd_videoframe(uint32_t dest, uint32_t result_ptr)
+{
+	eve_begin_cmd(CMD_VIDEOFRAME);
+	spi_transmit_32(dest);
+	spi_transmit_32(result_ptr);
+	EVE_cs_clear();
+	while (EVE_busy());
+}
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------- special purpose functions ------------------- --------------------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+
+/* this is meant to be called outside display-list building */
+/* with EVE_BURST_ONLY the calibration screen is sent with the _burst functions */
+/* this function displays an interactive calibration screen, calculates the calibration values and */
+/* writes the new values to the touch matrix registers of EVE */
+/* unlike the built-in cmd_calibrate() of EVE this also works with displays that are cut down from larger ones like EVE2-38A / EVE2-38G */
+/* the height is needed as parameter as EVE_VSIZE for the EVE2-38 is 272 but the visible size is only 116 */
+/* so the call would be EVE_calibrate_manual(116); for the EVE2-38A and EVE2-38G while for most other displays */
+/* using EVE_calibrate_manual(EVE_VSIZE) would work - but for normal displays the built-in cmd_calibrate would work as expected anyways */
+/* this code was taken from the MatrixOrbital EVE2-Library on Github, adapted and modified */
+void EVE_calibrate_manual(uint16_t height)
+{
+	uint32_t displayX[3], displayY[3];
+	uint32_t touchX[3], touchY[3];
+	uint32_t touchValue;
+	int32_t tmp, k;
+	int32_t TransMatrix[6];
+	uint8_t count = 0;
+	char num[2];
+	uint8_t touch_lock = 1;
+
+	/* these values determine where your calibration points will be drawn on your display */
+	displayX[0] = (EVE_HSIZE * 0.15);
+	displayY[0] = (height * 0.15);
+
+	displayX[1] = (EVE_HSIZE * 0.85);
+	displayY[1] = (height / 2);
+
+	displayX[2] = (EVE_HSIZE / 2);
+	displayY[2] = (height * 0.85);
+
+	while (count < 3)
+	{
+#if defined (EVE_BURST_ONLY)
+		EVE_start_cmd_burst();
+		EVE_cmd_dl_burst(CMD_DLSTART);
+		EVE_cmd_dl_burst(DL_CLEAR_RGB | 0x000000);
+		EVE_cmd_dl_burst(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
+
+		/* draw Calibration Point on screen */
+		EVE_cmd_dl_burst(DL_COLOR_RGB | 0x0000ff);
+		EVE_cmd_dl_burst(POINT_SIZE(20*16));
+		EVE_cmd_dl_burst((DL_BEGIN | EVE_POINTS));
+		EVE_cmd_dl_burst(VERTEX2F((uint32_t)(displayX[count]) * 16, (uint32_t)((displayY[count])) * 16));
+		EVE_cmd_dl_burst(DL_END);
+		EVE_cmd_dl_burst(DL_COLOR_RGB | 0xffffff);
+		EVE_cmd_text_burst((EVE_HSIZE/2), 50, 27, EVE_OPT_CENTER, "Please tap on the dot.");
+		num[0] = count + 0x31; num[1] = 0; /* null terminated string of one character */
+		EVE_cmd_text_burst(displayX[count], displayY[count], 27, EVE_OPT_CENTER, num);
+
+		EVE_cmd_dl_burst(DL_DISPLAY);
+		EVE_cmd_dl_burst(CMD_SWAP);
+		EVE_end_cmd_burst();
+#else
+		EVE_cmd_dl(CMD_DLSTART);
+		EVE_cmd_dl(DL_CLEAR_RGB | 0x000000);
+		EVE_cmd_dl(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
+
+		/* draw Calibration Point on screen */
+		EVE_cmd_dl(DL_COLOR_RGB | 0x0000ff);
+		EVE_cmd_dl(POINT_SIZE(20*16));
+		EVE_cmd_dl((DL_BEGIN | EVE_POINTS));
+		EVE_cmd_dl(VERTEX2F((uint32_t)(displayX[count]) * 16, (uint32_t)((displayY[count])) * 16));
+		EVE_cmd_dl(DL_END);
+		EVE_cmd_dl(DL_COLOR_RGB | 0xffffff);
+		EVE_cmd_text((EVE_HSIZE/2), 50, 27, EVE_OPT_CENTER, "Please tap on the dot.");
+		num[0] = count + 0x31; num[1] = 0; /* null terminated string of one character */
+		EVE_cmd_text(displayX[count], displayY[count], 27, EVE_OPT_CENTER, num);
+
+		EVE_cmd_dl(DL_DISPLAY);
+		EVE_cmd_dl(CMD_SWAP);
+#endif
+		while (EVE_busy());
+
+		while(1)
+		{
+			touchValue = EVE_memRead32(REG_TOUCH_DIRECT_XY); /* read for any new touch tag inputs */
+
+			if(touch_lock)
+			{
+				if(touchValue & 0x80000000) /* check if we have no touch */
+				{
+					touch_lock = 0;
+				}
+			}
+			else
+			{
+				if (!(touchValue & 0x80000000)) /* check if a touch is detected */
+				{
+					touchX[count] = (touchValue>>16) & 0x03FF; /* raw Touchscreen Y coordinate */
+					touchY[count] = touchValue & 0x03FF; /* raw Touchscreen Y coordinate */
+					touch_lock = 1;
+					count++;
+					break; /* leave while(1) */
+				}
+			}
+		}
+	}
+
+	k = ((touchX[0] - touchX[2])*(touchY[1] - touchY[2])) - ((touchX[1] - touchX[2])*(touchY[0] - touchY[2]));
+
+	tmp = (((displayX[0] - displayX[2]) * (touchY[1] - touchY[2])) - ((displayX[1] - displayX[2])*(touchY[0] - touchY[2])));
+	TransMatrix[0] = ((int64_t)tmp << 16) / k;
+
+	tmp = (((touchX[0] - touchX[2]) * (displayX[1] - displayX[2])) - ((displayX[0] - displayX[2])*(touchX[1] - touchX[2])));
+	TransMatrix[1] = ((int64_t)tmp << 16) / k;
+
+	tmp = ((touchY[0] * (((touchX[2] * displayX[1]) - (touchX[1] * displayX[2])))) + (touchY[1] * (((touchX[0] * displayX[2]) - (touchX[2] * displayX[0])))) + (touchY[2] * (((touchX[1] * displayX[0]) - (touchX[0] * displayX[1])))));
+	TransMatrix[2] = ((int64_t)tmp << 16) / k;
+
+	tmp = (((displayY[0] - displayY[2]) * (touchY[1] - touchY[2])) - ((displayY[1] - displayY[2])*(touchY[0] - touchY[2])));
+	TransMatrix[3] = ((int64_t)tmp << 16) / k;
+
+	tmp = (((touchX[0] - touchX[2]) * (displayY[1] - displayY[2])) - ((displayY[0] - displayY[2])*(touchX[1] - touchX[2])));
+	TransMatrix[4] = ((int64_t)tmp << 16) / k;
+
+	tmp = ((touchY[0] * (((touchX[2] * displayY[1]) - (touchX[1] * displayY[2])))) + (touchY[1] * (((touchX[0] * displayY[2]) - (touchX[2] * displayY[0])))) + (touchY[2] * (((touchX[1] * displayY[0]) - (touchX[0] * displayY[1])))));
+	TransMatrix[5] = ((int64_t)tmp << 16) / k;
+
+	EVE_memWrite32(REG_TOUCH_TRANSFORM_A, TransMatrix[0]);
+	EVE_memWrite32(REG_TOUCH_TRANSFORM_B, TransMatrix[1]);
+	EVE_memWrite32(REG_TOUCH_TRANSFORM_C, TransMatrix[2]);
+	EVE_memWrite32(REG_TOUCH_TRANSFORM_D, TransMatrix[3]);
+	EVE_memWrite32(REG_TOUCH_TRANSFORM_E, TransMatrix[4]);
+	EVE_memWrite32(REG_TOUCH_TRANSFORM_F, TransMatrix[5]);
+}
@@ -0,0 +1,1090 @@
+/*
+@file    EVE_commands_dl.c
+@brief   contains FT8xx / BT8xx display-list functions that work outside cmd-burst
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+These were split off from EVE_commands.c, each one is transmitted in a single SPI transfer with the command-fifo address.
+Calls between EVE_start_cmd_burst() and EVE_end_cmd_burst() are ignored, use the _burst variants there.
+Define EVE_BURST_ONLY to leave these out of the build.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+@section History
+
+5.0
+- split off from EVE_commands.c
+- added EVE_cmd_text_len() and EVE_cmd_text_packed()
+- EVE_cmd_button_var(), EVE_cmd_text_var() and EVE_cmd_toggle_var() are available for FT81x as well now, these convert the string on the host
+- added EVE_cmd_number_fixed()
+- moved EVE_cmd_calibrate(), EVE_cmd_calibratesub(), EVE_cmd_getmatrix() and EVE_calibrate_manual() to EVE_commands_copro.c so these are there with EVE_BURST_ONLY as well
+
+*/
+
+#include "EVE.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_BURST_ONLY)
+
+#include <stdarg.h>
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*-------- functions for display lists ---------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+
+/* BT817 / BT818 */
+#if EVE_GEN > 3
+
+void EVE_cmd_animframeram(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMFRAMERAM);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit_32(aoptr);
+		spi_transmit_32(frame);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_animstartram(int32_t ch, uint32_t aoptr, uint32_t loop)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMSTARTRAM);
+		spi_transmit_32(ch);
+		spi_transmit_32(aoptr);
+		spi_transmit_32(loop);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_apilevel(uint32_t level)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_APILEVEL);
+		spi_transmit_32(level);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_calllist(uint32_t adr)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_CALLLIST);
+		spi_transmit_32(adr);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_hsf(uint32_t hsf)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_HSF);
+		spi_transmit_32(hsf);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_runanim(uint32_t waitmask, uint32_t play)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_RUNANIM);
+		spi_transmit_32(waitmask);
+		spi_transmit_32(play);
+		EVE_cs_clear();
+	}
+}
+
+
+#endif /* EVE_GEN > 3 */
+
+
+/* BT815 / BT816 */
+#if EVE_GEN > 2
+
+void EVE_cmd_animdraw(int32_t ch)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMDRAW);
+		spi_transmit_32(ch);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_animframe(int16_t x0, int16_t y0, uint32_t aoptr, uint32_t frame)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMFRAME);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit_32(aoptr);
+		spi_transmit_32(frame);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_animstart(int32_t ch, uint32_t aoptr, uint32_t loop)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMSTART);
+
+		spi_transmit_32(ch);
+		spi_transmit_32(aoptr);
+		spi_transmit_32(loop);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_animstop(int32_t ch)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMSTOP);
+		spi_transmit_32(ch);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_animxy(int32_t ch, int16_t x0, int16_t y0)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ANIMXY);
+		spi_transmit_32(ch);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_appendf(uint32_t ptr, uint32_t num)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_APPENDF);
+		spi_transmit_32(ptr);
+		spi_transmit_32(num);
+		EVE_cs_clear();
+	}
+}
+
+
+uint16_t EVE_cmd_bitmap_transform(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2)
+{
+	if(!cmd_burst)
+	{
+		uint16_t cmdoffset;
+
+		eve_begin_cmd(CMD_BITMAP_TRANSFORM);
+		spi_transmit_32(x0);
+		spi_transmit_32(y0);
+		spi_transmit_32(x1);
+		spi_transmit_32(y1);
+		spi_transmit_32(x2);
+		spi_transmit_32(y2);
+		spi_transmit_32(tx0);
+		spi_transmit_32(ty0);
+		spi_transmit_32(tx1);
+		spi_transmit_32(ty1);
+		spi_transmit_32(tx2);
+		spi_transmit_32(ty2);
+		spi_transmit_32(0);
+		EVE_cs_clear();
+		while (EVE_busy());
+		cmdoffset = EVE_memRead16(REG_CMD_WRITE);  /* read the graphics processor write pointer */
+		cmdoffset -= 4;
+		cmdoffset &= 0x0fff;
+		return (EVE_memRead32(EVE_RAM_CMD + cmdoffset));
+	}
+	return 0;
+}
+
+
+void EVE_cmd_fillwidth(uint32_t s)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_FILLWIDTH);
+		spi_transmit_32(s);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_gradienta(int16_t x0, int16_t y0, uint32_t argb0, int16_t x1, int16_t y1, uint32_t argb1)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_GRADIENTA);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit_32(argb0);
+
+		spi_transmit((uint8_t)(x1));
+		spi_transmit((uint8_t)(x1 >> 8));
+		spi_transmit((uint8_t)(y1));
+		spi_transmit((uint8_t)(y1 >> 8));
+
+		spi_transmit_32(argb1);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_rotatearound(int32_t x0, int32_t y0, int32_t angle, int32_t scale)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ROTATEAROUND);
+		spi_transmit_32(x0);
+		spi_transmit_32(y0);
+		spi_transmit_32(angle);
+		spi_transmit_32(scale);
+		EVE_cs_clear();
+	}
+}
+
+
+#endif /* EVE_GEN > 2 */
+
+
+/* as the name implies, "num_args" is the number of arguments passed to this function as variadic arguments */
+/* FT81x do not have EVE_OPT_FORMAT, with EVE_GEN < 3 the string is converted on the host instead */
+void EVE_cmd_button_var(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
+{
+	if(!cmd_burst)
+	{
+		va_list arguments;
+
+		va_start(arguments, num_args);
+		eve_begin_cmd(CMD_BUTTON);
+		spi_transmit_32((uint32_t) x0 + ((uint32_t) y0 << 16));
+		spi_transmit_32((uint32_t) w0 + ((uint32_t) h0 << 16));
+
+#if EVE_GEN > 2
+		spi_transmit_32((uint32_t) font + ((uint32_t) options << 16));
+		private_string_write(text);
+
+		if(options & EVE_OPT_FORMAT)
+		{
+			uint8_t counter;
+
+			for(counter=0;counter<num_args;counter++)
+			{
+				spi_transmit_32((uint32_t) va_arg(arguments, int));
+			}
+		}
+#else
+		spi_transmit_32((uint32_t) font + ((uint32_t) (options & ~EVE_OPT_FORMAT) << 16));
+
+		if(options & EVE_OPT_FORMAT)
+		{
+			private_format_write(text, num_args, arguments);
+		}
+		else
+		{
+			private_string_write(text);
+		}
+#endif
+
+		va_end(arguments);
+		EVE_cs_clear();
+	}
+}
+
+
+/* as the name implies, "num_args" is the number of arguments passed to this function as variadic arguments */
+/* FT81x do not have EVE_OPT_FORMAT, with EVE_GEN < 3 the string is converted on the host instead */
+void EVE_cmd_text_var(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint8_t num_args, ...)
+{
+	if(!cmd_burst)
+	{
+		va_list arguments;
+
+		va_start(arguments, num_args);
+		eve_begin_cmd(CMD_TEXT);
+		spi_transmit_32((uint32_t) x0 + ((uint32_t) y0 << 16));
+
+#if EVE_GEN > 2
+		spi_transmit_32((uint32_t) font + ((uint32_t) options << 16));
+		private_string_write(text);
+
+		if(options & EVE_OPT_FORMAT)
+		{
+			uint8_t counter;
+
+			for(counter=0;counter<num_args;counter++)
+			{
+				spi_transmit_32((uint32_t) va_arg(arguments, int));
+			}
+		}
+#else
+		spi_transmit_32((uint32_t) font + ((uint32_t) (options & ~EVE_OPT_FORMAT) << 16));
+
+		if(options & EVE_OPT_FORMAT)
+		{
+			private_format_write(text, num_args, arguments);
+		}
+		else
+		{
+			private_string_write(text);
+		}
+#endif
+
+		va_end(arguments);
+		EVE_cs_clear();
+	}
+}
+
+
+/* as the name implies, "num_args" is the number of arguments passed to this function as variadic arguments */
+/* FT81x do not have EVE_OPT_FORMAT, with EVE_GEN < 3 the string is converted on the host instead */
+void EVE_cmd_toggle_var(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text, uint8_t num_args, ...)
+{
+	if(!cmd_burst)
+	{
+		va_list arguments;
+
+		va_start(arguments, num_args);
+		eve_begin_cmd(CMD_TOGGLE);
+		spi_transmit_32((uint32_t) x0 + ((uint32_t) y0 << 16));
+		spi_transmit_32((uint32_t) w0 + ((uint32_t) font << 16));
+
+#if EVE_GEN > 2
+		spi_transmit_32((uint32_t) options + ((uint32_t) state << 16));
+		private_string_write(text);
+
+		if(options & EVE_OPT_FORMAT)
+		{
+			uint8_t counter;
+
+			for(counter=0;counter<num_args;counter++)
+			{
+				spi_transmit_32((uint32_t) va_arg(arguments, int));
+			}
+		}
+#else
+		spi_transmit_32((uint32_t) (options & ~EVE_OPT_FORMAT) + ((uint32_t) state << 16));
+
+		if(options & EVE_OPT_FORMAT)
+		{
+			private_format_write(text, num_args, arguments);
+		}
+		else
+		{
+			private_string_write(text);
+		}
+#endif
+
+		va_end(arguments);
+		EVE_cs_clear();
+	}
+}
+
+
+
+/* generic function for all commands that have no arguments and all display-list specific control words */
+/*
+ examples:
+ EVE_cmd_dl(CMD_DLSTART);
+ EVE_cmd_dl(CMD_SWAP);
+ EVE_cmd_dl(CMD_SCREENSAVER);
+ EVE_cmd_dl(LINE_WIDTH(1*16));
+ EVE_cmd_dl(VERTEX2F(0,0));
+ EVE_cmd_dl(DL_BEGIN | EVE_RECTS);
+*/
+void EVE_cmd_dl(uint32_t command)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(command);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_append(uint32_t ptr, uint32_t num)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_APPEND);
+		spi_transmit_32(ptr);
+		spi_transmit_32(num);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_bgcolor(uint32_t color)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_BGCOLOR);
+		spi_transmit((uint8_t)(color));
+		spi_transmit((uint8_t)(color >> 8));
+		spi_transmit((uint8_t)(color >> 16));
+		spi_transmit(0x00);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_button(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_BUTTON);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+
+		spi_transmit((uint8_t)(h0));
+		spi_transmit((uint8_t)(h0 >> 8));
+
+		spi_transmit((uint8_t)(font));
+		spi_transmit((uint8_t)(font >> 8));
+
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		private_string_write(text);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_clock(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t hours, uint16_t minutes, uint16_t seconds, uint16_t millisecs)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_CLOCK);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(r0));
+		spi_transmit((uint8_t)(r0 >> 8));
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		spi_transmit((uint8_t)(hours));
+		spi_transmit((uint8_t)(hours >> 8));
+		spi_transmit((uint8_t)(minutes));
+		spi_transmit((uint8_t)(minutes >> 8));
+
+		spi_transmit((uint8_t)(seconds));
+		spi_transmit((uint8_t)(seconds >> 8));
+		spi_transmit((uint8_t)(millisecs));
+		spi_transmit((uint8_t)(millisecs >> 8));
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_dial(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t val)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_DIAL);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(r0));
+		spi_transmit((uint8_t)(r0 >> 8));
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		spi_transmit((uint8_t)(val));
+		spi_transmit((uint8_t)(val >> 8));
+		spi_transmit(0);
+		spi_transmit(0);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_fgcolor(uint32_t color)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_FGCOLOR);
+		spi_transmit((uint8_t)(color));
+		spi_transmit((uint8_t)(color >> 8));
+		spi_transmit((uint8_t)(color >> 16));
+		spi_transmit(0x00);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_gauge(int16_t x0, int16_t y0, int16_t r0, uint16_t options, uint16_t major, uint16_t minor, uint16_t val, uint16_t range)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_GAUGE);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(r0));
+		spi_transmit((uint8_t)(r0 >> 8));
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		spi_transmit((uint8_t)(major));
+		spi_transmit((uint8_t)(major >> 8));
+		spi_transmit((uint8_t)(minor));
+		spi_transmit((uint8_t)(minor >> 8));
+
+		spi_transmit((uint8_t)(val));
+		spi_transmit((uint8_t)(val >> 8));
+		spi_transmit((uint8_t)(range));
+		spi_transmit((uint8_t)(range >> 8));
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_gradcolor(uint32_t color)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_GRADCOLOR);
+		spi_transmit((uint8_t)(color));
+		spi_transmit((uint8_t)(color >> 8));
+		spi_transmit((uint8_t)(color >> 16));
+		spi_transmit(0x00);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_gradient(int16_t x0, int16_t y0, uint32_t rgb0, int16_t x1, int16_t y1, uint32_t rgb1)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_GRADIENT);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(rgb0));
+		spi_transmit((uint8_t)(rgb0 >> 8));
+		spi_transmit((uint8_t)(rgb0 >> 16));
+		spi_transmit(0x00);
+
+		spi_transmit((uint8_t)(x1));
+		spi_transmit((uint8_t)(x1 >> 8));
+		spi_transmit((uint8_t)(y1));
+		spi_transmit((uint8_t)(y1 >> 8));
+
+		spi_transmit((uint8_t)(rgb1));
+		spi_transmit((uint8_t)(rgb1 >> 8));
+		spi_transmit((uint8_t)(rgb1 >> 16));
+		spi_transmit(0x00);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_keys(int16_t x0, int16_t y0, int16_t w0, int16_t h0, int16_t font, uint16_t options, const char* text)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_KEYS);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+		spi_transmit((uint8_t)(h0));
+		spi_transmit((uint8_t)(h0 >> 8));
+
+		spi_transmit((uint8_t)(font));
+		spi_transmit((uint8_t)(font >> 8));
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		private_string_write(text);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_number(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_NUMBER);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(font));
+		spi_transmit((uint8_t)(font >> 8));
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		spi_transmit_32(number);
+		EVE_cs_clear();
+	}
+}
+
+
+/* prints a number with a fixed amount of decimal places, EVE_cmd_number_fixed(10, 10, 28, EVE_OPT_SIGNED, -1234, 2) shows "-12.34" */
+/* the options are the same as for EVE_cmd_number(), the number is converted on the host and sent with CMD_TEXT */
+/* decimals are limited to 254 so that the digit in front of the point still fits into the 255 digits of the precision */
+void EVE_cmd_number_fixed(int16_t x0, int16_t y0, int16_t font, uint16_t options, int32_t number, uint8_t decimals)
+{
+	if(decimals > 254U)
+	{
+		decimals = 254U;
+	}
+
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_TEXT);
+		spi_transmit_32((uint32_t) x0 + ((uint32_t) y0 << 16));
+		spi_transmit_32((uint32_t) font + ((uint32_t) (options & 0xfe00U) << 16));
+		private_fixed_write(number, options, decimals);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_progress(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_PROGRESS);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+		spi_transmit((uint8_t)(h0));
+		spi_transmit((uint8_t)(h0 >> 8));
+
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+		spi_transmit((uint8_t)(val));
+		spi_transmit((uint8_t)(val >> 8));
+
+		spi_transmit((uint8_t)(range));
+		spi_transmit((uint8_t)(range >> 8));
+		spi_transmit(0x00);	/* dummy byte for 4-byte alignment */
+		spi_transmit(0x00); /* dummy byte for 4-byte alignment */
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_romfont(uint32_t font, uint32_t romslot)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ROMFONT);
+
+		spi_transmit((uint8_t)(font));
+		spi_transmit((uint8_t)(font >> 8));
+		spi_transmit(0x00);
+		spi_transmit(0x00);
+
+		spi_transmit((uint8_t)(romslot));
+		spi_transmit((uint8_t)(romslot >> 8));
+		spi_transmit(0x00);
+		spi_transmit(0x00);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_rotate(int32_t angle)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_ROTATE);
+		spi_transmit_32(angle);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_scale(int32_t sx, int32_t sy)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SCALE);
+		spi_transmit_32(sx);
+		spi_transmit_32(sy);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_scrollbar(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t size, uint16_t range)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SCROLLBAR);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+		spi_transmit((uint8_t)(h0));
+		spi_transmit((uint8_t)(h0 >> 8));
+
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+		spi_transmit((uint8_t)(val));
+		spi_transmit((uint8_t)(val >> 8));
+
+		spi_transmit((uint8_t)(size));
+		spi_transmit((uint8_t)(size >> 8));
+		spi_transmit((uint8_t)(range));
+		spi_transmit((uint8_t)(range >> 8));
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_setbase(uint32_t base)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SETBASE);
+		spi_transmit_32(base);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_setbitmap(uint32_t addr, uint16_t fmt, uint16_t width, uint16_t height)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SETBITMAP);
+		spi_transmit_32(addr);
+
+		spi_transmit((uint8_t)(fmt));
+		spi_transmit((uint8_t)(fmt>> 8));
+		spi_transmit((uint8_t)(width));
+		spi_transmit((uint8_t)(width >> 8));
+
+		spi_transmit((uint8_t)(height));
+		spi_transmit((uint8_t)(height >> 8));
+		spi_transmit(0);
+		spi_transmit(0);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_setfont(uint32_t font, uint32_t ptr)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SETFONT);
+		spi_transmit_32(font);
+		spi_transmit_32(ptr);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_setfont2(uint32_t font, uint32_t ptr, uint32_t firstchar)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SETFONT2);
+		spi_transmit_32(font);
+		spi_transmit_32(ptr);
+		spi_transmit_32(firstchar);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_setscratch(uint32_t handle)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SETSCRATCH);
+		spi_transmit_32(handle);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_sketch(int16_t x0, int16_t y0, uint16_t w0, uint16_t h0, uint32_t ptr, uint16_t format)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SKETCH);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+		spi_transmit((uint8_t)(h0));
+		spi_transmit((uint8_t)(h0 >> 8));
+
+		spi_transmit_32(ptr);
+
+		spi_transmit((uint8_t)(format));
+		spi_transmit((uint8_t)(format >> 8));
+		spi_transmit(0);
+		spi_transmit(0);
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_slider(int16_t x0, int16_t y0, int16_t w0, int16_t h0, uint16_t options, uint16_t val, uint16_t range)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SLIDER);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+		spi_transmit((uint8_t)(h0));
+		spi_transmit((uint8_t)(h0 >> 8));
+
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+		spi_transmit((uint8_t)(val));
+		spi_transmit((uint8_t)(val >> 8));
+
+		spi_transmit((uint8_t)(range));
+		spi_transmit((uint8_t)(range >> 8));
+		spi_transmit(0x00); /* dummy byte for 4-byte alignment */
+		spi_transmit(0x00); /* dummy byte for 4-byte alignment */
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_spinner(int16_t x0, int16_t y0, uint16_t style, uint16_t scale)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_SPINNER);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(style));
+		spi_transmit((uint8_t)(style >> 8));
+		spi_transmit((uint8_t)(scale));
+		spi_transmit((uint8_t)(scale >> 8));
+
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_text(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_TEXT);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(font));
+		spi_transmit((uint8_t)(font >> 8));
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+
+		private_string_write(text);
+		EVE_cs_clear();
+	}
+}
+
+
+/* same as EVE_cmd_text() but for a string with a known length that does not need to be zero-terminated */
+void EVE_cmd_text_len(int16_t x0, int16_t y0, int16_t font, uint16_t options, const char* text, uint32_t length)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_TEXT);
+		spi_transmit_32((uint32_t) x0 + ((uint32_t) y0 << 16));
+		spi_transmit_32((uint32_t) font + ((uint32_t) options << 16));
+		private_string_write_len(text, length);
+		EVE_cs_clear();
+	}
+}
+
+
+/* same as EVE_cmd_text() but for a string that was converted with EVE_pack_string() before */
+void EVE_cmd_text_packed(int16_t x0, int16_t y0, int16_t font, uint16_t options, const uint32_t *words, uint16_t num)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_TEXT);
+		spi_transmit_32((uint32_t) x0 + ((uint32_t) y0 << 16));
+		spi_transmit_32((uint32_t) font + ((uint32_t) options << 16));
+		private_words_write(words, num);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_toggle(int16_t x0, int16_t y0, int16_t w0, int16_t font, uint16_t options, uint16_t state, const char* text)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_TOGGLE);
+
+		spi_transmit((uint8_t)(x0));
+		spi_transmit((uint8_t)(x0 >> 8));
+		spi_transmit((uint8_t)(y0));
+		spi_transmit((uint8_t)(y0 >> 8));
+
+		spi_transmit((uint8_t)(w0));
+		spi_transmit((uint8_t)(w0 >> 8));
+		spi_transmit((uint8_t)(font));
+		spi_transmit((uint8_t)(font >> 8));
+
+		spi_transmit((uint8_t)(options));
+		spi_transmit((uint8_t)(options >> 8));
+		spi_transmit((uint8_t)(state));
+		spi_transmit((uint8_t)(state >> 8));
+
+		private_string_write(text);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_cmd_translate(int32_t tx, int32_t ty)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(CMD_TRANSLATE);
+		spi_transmit_32(tx);
+		spi_transmit_32(ty);
+		EVE_cs_clear();
+	}
+}
+
+
+void EVE_color_rgb(uint32_t color)
+{
+	if(!cmd_burst)
+	{
+		eve_begin_cmd(DL_COLOR_RGB | color);
+		EVE_cs_clear();
+	}
+}
+
+#endif /* EVE_BURST_ONLY */
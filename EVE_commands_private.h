@@ -0,0 +1,103 @@
+/*
+@file    EVE_commands_private.h
+@brief   internal definitions shared between EVE_commands.c and the EVE_commands_xxx.c files, not for use by the application
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- split off from EVE_commands.c
+- added the prototypes for the length-aware and pre-packed string functions
+- added the prototypes for the host-side formatting functions
+- added the prototype for private_block_write_burst()
+- added eve_fnv1a() for the modules that hash their data
+
+*/
+
+#pragma once
+
+#ifndef EVE_COMMANDS_PRIVATE_H_
+#define EVE_COMMANDS_PRIVATE_H_
+
+#include <stdarg.h>
+#include "EVE.h"
+
+#if defined (EVE_BURST_ONLY) && defined (EVE_NO_BURST)
+#error "EVE_BURST_ONLY and EVE_NO_BURST together would leave no display-list functions at all"
+#endif
+
+#if defined (EVE_NO_BURST) && defined (EVE_DMA)
+#error "EVE_DMA needs the _burst functions, EVE_NO_BURST can not be used with it"
+#endif
+
+/* EVE Memory Commands - used with EVE_memWritexx and EVE_memReadxx */
+#define MEM_WRITE	0x80 /* EVE Host Memory Write */
+#define MEM_READ	0x00 /* EVE Host Memory Read */
+
+extern volatile uint8_t cmd_burst; /* flag to indicate cmd-burst is active */
+
+/* begin a co-processor command, this is used for non-display-list and non-burst-mode commands */
+void eve_begin_cmd(uint32_t command);
+
+/* write data to co-processor memory in context of a command: no chip-select, just plain SPI-transfers */
+void private_block_write(const uint8_t *data, uint16_t len);
+
+/* write data into the command-fifo for cmd-burst, padded to a multiple of four bytes */
+void private_block_write_burst(const uint8_t *data, uint32_t len);
+
+/* transfer data to the command-fifo in chunks, including chip-select and waiting for completion */
+void block_transfer(const uint8_t *data, uint32_t len);
+
+/* write a string to co-processor memory in context of a command: no chip-select, just plain SPI-transfers */
+void private_string_write(const char *text);
+void private_string_write_len(const char *text, uint32_t length);
+void private_words_write(const uint32_t *words, uint32_t num);
+void private_string_write_burst(const char *text);
+void private_string_write_len_burst(const char *text, uint32_t length);
+void private_words_write_burst(const uint32_t *words, uint32_t num);
+
+/* write a string with the arguments converted by the host, for FT81x that do not have EVE_OPT_FORMAT */
+void private_format_write(const char *text, uint8_t num_args, va_list arguments);
+void private_format_write_burst(const char *text, uint8_t num_args, va_list arguments);
+
+/* write a number with a fixed amount of decimal places as string */
+void private_fixed_write(int32_t number, uint16_t options, uint8_t decimals);
+void private_fixed_write_burst(int32_t number, uint16_t options, uint8_t decimals);
+
+#define EVE_FNV1A_INIT 2166136261UL
+
+/* FNV-1a, continues "hash" over "size" bytes, the first call starts with EVE_FNV1A_INIT */
+/* the caches and the change detection of EVE_region.c, EVE_list.c, EVE_snapshot.c, EVE_widget.c and EVE_redraw.c use this */
+static inline uint32_t eve_fnv1a(uint32_t hash, const void *data, uint32_t size)
+{
+	const uint8_t *bytes = (const uint8_t *) data;
+
+	while(size > 0)
+	{
+		hash ^= *bytes++;
+		hash *= 16777619UL;
+		size--;
+	}
+	return hash;
+}
+
+#endif /* EVE_COMMANDS_PRIVATE_H_ */
@@ -67,6 +67,10 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 - added a profile for the EVE4x-70G IPS from Matrix Orbital
 - added a profile for RiTFT35 from Riverdi
 - changed the clock-polarity for EVE_EVE4_70G
+- added the options EVE_BURST_ONLY and EVE_NO_BURST to select which families of display-list functions are built
+- added the option EVE_RTOS for the display owner task in EVE_rtos.c
+- added the option EVE_RTOS_PIPELINE
+- added the option EVE_HOST
 
 */
 
@@ -151,6 +155,29 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 #define EVE_EVE3_50G
 
 
+/* select which families of display-list functions are built, by default both are */
+/* EVE_BURST_ONLY leaves out the functions from EVE_commands_dl.c that send every command in a separate SPI transfer */
+/* EVE_NO_BURST leaves out the functions from EVE_commands_burst.c, this does not work together with EVE_DMA */
+#if 0
+  #define EVE_BURST_ONLY
+  #define EVE_NO_BURST
+#endif
+
+/* EVE_RTOS builds EVE_rtos.c, a display owner task with a lock-free job queue for multi-tasking applications */
+/* EVE_RTOS_PTHREAD selects POSIX threads instead of FreeRTOS, the INT pin can be used with EVE_INT in EVE_target.h */
+/* EVE_RTOS_PIPELINE builds frames in the calling task and only transmits them in the owner task, this needs EVE_DMA */
+#if 0
+  #define EVE_RTOS
+  #define EVE_RTOS_PTHREAD
+  #define EVE_RTOS_PIPELINE
+#endif
+
+/* EVE_HOST builds EVE_host.c, a multi-threaded frame pipeline for Linux hosts */
+#if 0
+  #define EVE_HOST
+#endif
+
+
 /* display timing parameters below */
 
 /* ----------- 320 x 240 ----------- */
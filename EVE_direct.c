@@ -0,0 +1,131 @@
+/*
+@file    EVE_direct.c
+@brief   display-lists written straight to RAM_DL, without the co-processor
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_direct.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_direct.h"
+#include "EVE_commands_private.h"
+
+
+/* returns 1 if RAM_DL can be written, the co-processor is idle and the last swap is done */
+uint8_t EVE_direct_ready(void)
+{
+	if(EVE_busy())
+	{
+		return 0;
+	}
+	return (EVE_memRead8(REG_DLSWAP) == EVE_DLSWAP_DONE) ? 1 : 0;
+}
+
+
+static void direct_swap(void)
+{
+	EVE_memWrite32(REG_DLSWAP, EVE_DLSWAP_FRAME);
+}
+
+
+/* write a complete display-list to RAM_DL and swap it in at the end of the current frame */
+/* a list with more than 2048 words does not fit into RAM_DL and is not written at all */
+void EVE_direct_write(const uint32_t *list, uint16_t words)
+{
+	uint32_t ftAddress = EVE_RAM_DL;
+
+	if(words > (EVE_RAM_DL_SIZE / 4))
+	{
+		return;
+	}
+
+	while(!EVE_direct_ready());
+
+	EVE_cs_set();
+	spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE);
+	spi_transmit((uint8_t)(ftAddress >> 8));
+	spi_transmit((uint8_t)(ftAddress));
+
+	while(words > 0)
+	{
+		spi_transmit_32(*list++);
+		words--;
+	}
+	EVE_cs_clear();
+
+	direct_swap();
+}
+
+
+#if !defined (EVE_NO_BURST)
+
+/* like EVE_start_cmd_burst() but the burst goes to RAM_DL */
+void EVE_direct_begin_burst(void)
+{
+	uint32_t ftAddress = EVE_RAM_DL;
+
+	while(!EVE_direct_ready());
+
+	cmd_burst = 42;
+
+	#if defined (EVE_DMA)
+		#if defined (EVE_DMA_THREAD)
+		if(EVE_dma_buffer == NULL)
+		{
+			EVE_dma_buffer = EVE_dma_thread_buffer();
+		}
+		#endif
+		EVE_dma_buffer[0] = ((uint8_t)(ftAddress >> 16) | MEM_WRITE) | (ftAddress & 0x0000ff00) |  ((uint8_t)(ftAddress) << 16);
+		EVE_dma_buffer[0] = EVE_dma_buffer[0] << 8;
+		EVE_dma_buffer_index = 1;
+	#else
+		EVE_cs_set();
+		spi_transmit((uint8_t)(ftAddress >> 16) | MEM_WRITE);
+		spi_transmit((uint8_t)(ftAddress >> 8));
+		spi_transmit((uint8_t)(ftAddress));
+	#endif
+}
+
+
+void EVE_direct_end_burst(void)
+{
+	cmd_burst = 0;
+
+	#if defined (EVE_DMA)
+		EVE_start_dma_transfer();
+		while(EVE_dma_busy); /* REG_DLSWAP can only be written after the list arrived */
+	#else
+		EVE_cs_clear();
+	#endif
+
+	direct_swap();
+}
+
+#endif /* EVE_NO_BURST */
@@ -0,0 +1,77 @@
+/*
+@file    EVE_direct.h
+@brief   display-lists written straight to RAM_DL, without the co-processor
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+A frame that only consists of display-list commands does not need the co-processor.
+Instead of sending it thru REG_CMDB_WRITE the host writes it to RAM_DL with one memory write
+and makes it visible with REG_DLSWAP = EVE_DLSWAP_FRAME.
+This saves the time the co-processor needs to copy the list and does not use any space in the command-fifo.
+
+if(EVE_direct_ready())
+{
+	EVE_direct_begin_burst();
+	EVE_cmd_dl_burst(DL_CLEAR_RGB | BLACK);
+	EVE_cmd_dl_burst(DL_CLEAR | CLR_COL | CLR_STN | CLR_TAG);
+	...
+	EVE_cmd_dl_burst(DL_DISPLAY);
+	EVE_direct_end_burst();
+}
+
+Only the EVE_cmd_dl_burst() function and the helpers like EVE_color_rgb_burst() or EVE_vertex2f_burst() can be used
+between EVE_direct_begin_burst() and EVE_direct_end_burst(), no co-processor commands like widgets or CMD_DLSTART / CMD_SWAP.
+EVE_direct_write() sends a list that was prepared in an array, with up to 2048 words, the size of RAM_DL.
+
+RAM_DL is double-buffered, the host only ever writes to the buffer that is not displayed and REG_DLSWAP stays non-zero
+until the buffers were swapped at the end of a frame.
+EVE_direct_ready() returns 1 when the co-processor is idle and no swap is pending, only then the buffer can be written.
+EVE_direct_begin_burst() and EVE_direct_write() wait for this.
+Direct frames and frames built by the co-processor can be mixed, the co-processor frames have to start with CMD_DLSTART as usual.
+With DMA a direct frame is limited to the size of EVE_dma_buffer and EVE_direct_end_burst() waits for the DMA transfer to
+finish before it writes REG_DLSWAP.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_DIRECT_H_
+#define EVE_DIRECT_H_
+
+#include "EVE_commands.h"
+
+uint8_t EVE_direct_ready(void);
+void EVE_direct_write(const uint32_t *list, uint16_t words);
+
+#if !defined (EVE_NO_BURST)
+void EVE_direct_begin_burst(void);
+void EVE_direct_end_burst(void);
+#endif
+
+#endif /* EVE_DIRECT_H_ */
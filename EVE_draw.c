@@ -0,0 +1,268 @@
+/*
+@file    EVE_draw.c
+@brief   drawing arrays of points, lines and rectangles with one BEGIN and culling on the host
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_draw.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_draw.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+/* the clip area, inclusive */
+static int16_t clip_x0 = 0;
+static int16_t clip_y0 = 0;
+static int16_t clip_x1 = EVE_HSIZE - 1;
+static int16_t clip_y1 = EVE_VSIZE - 1;
+
+/* state of the primitive that is being sent */
+static uint8_t draw_started;
+static uint8_t draw_format; /* VERTEX_FORMAT(0) was sent */
+
+
+void EVE_draw_set_clip(int16_t x, int16_t y, uint16_t w, uint16_t h)
+{
+	clip_x0 = x;
+	clip_y0 = y;
+	clip_x1 = (int16_t) (x + (int16_t) w - 1);
+	clip_y1 = (int16_t) (y + (int16_t) h - 1);
+}
+
+
+void EVE_draw_scissor_burst(int16_t x, int16_t y, uint16_t w, uint16_t h)
+{
+	EVE_draw_set_clip(x, y, w, h);
+	spi_transmit_burst(SCISSOR_XY(x, y));
+	spi_transmit_burst(SCISSOR_SIZE(w, h));
+}
+
+
+void EVE_draw_reset_clip_burst(void)
+{
+	EVE_draw_scissor_burst(0, 0, EVE_HSIZE, EVE_VSIZE);
+}
+
+
+/* returns 1 if the box with the corners x0 / y0 and x1 / y1 extended by margin touches the clip area */
+static uint8_t draw_visible(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t margin)
+{
+	int16_t swap;
+
+	if(x0 > x1)
+	{
+		swap = x0;
+		x0 = x1;
+		x1 = swap;
+	}
+	if(y0 > y1)
+	{
+		swap = y0;
+		y0 = y1;
+		y1 = swap;
+	}
+
+	return (((int32_t) x1 + margin >= clip_x0) && ((int32_t) x0 - margin <= clip_x1) &&
+			((int32_t) y1 + margin >= clip_y0) && ((int32_t) y0 - margin <= clip_y1)) ? 1U : 0U;
+}
+
+
+/* COLOR_RGB, the line-width or point-size and BEGIN are only sent for the first primitive that is visible */
+static void draw_begin(uint32_t primitive, uint32_t size, uint32_t color)
+{
+	if(draw_started == 0)
+	{
+		draw_started = 42;
+		spi_transmit_burst(DL_COLOR_RGB | (color & 0xffffffUL));
+		if(size != 0)
+		{
+			spi_transmit_burst(size);
+		}
+		spi_transmit_burst(DL_BEGIN | primitive);
+	}
+}
+
+
+static void draw_vertex(int16_t x, int16_t y)
+{
+	if(((uint16_t) x < 512U) && ((uint16_t) y < 512U))
+	{
+		spi_transmit_burst(VERTEX2II((uint32_t) x, (uint32_t) y, 0UL, 0UL));
+	}
+	else
+	{
+		if(draw_format == 0)
+		{
+			draw_format = 42;
+			spi_transmit_burst(VERTEX_FORMAT(0));
+		}
+		spi_transmit_burst(VERTEX2F((uint32_t) x, (uint32_t) y));
+	}
+}
+
+
+static void draw_end(void)
+{
+	if(draw_format != 0)
+	{
+		spi_transmit_burst(VERTEX_FORMAT(4));
+	}
+	if(draw_started != 0)
+	{
+		spi_transmit_burst(DL_END);
+	}
+	draw_started = 0;
+	draw_format = 0;
+}
+
+
+static int16_t draw_limit(int16_t value, int16_t low, int16_t high)
+{
+	if(value < low)
+	{
+		return low;
+	}
+	if(value > high)
+	{
+		return high;
+	}
+	return value;
+}
+
+
+uint16_t EVE_draw_rects_burst(const EVE_rect *rects, uint16_t count, uint32_t color)
+{
+	uint16_t index;
+	uint16_t drawn = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		const EVE_rect *rect = &rects[index];
+
+		if(draw_visible(rect->x0, rect->y0, rect->x1, rect->y1, 0))
+		{
+			draw_begin(EVE_RECTS, 0, color);
+			draw_vertex(draw_limit(rect->x0, clip_x0, clip_x1), draw_limit(rect->y0, clip_y0, clip_y1));
+			draw_vertex(draw_limit(rect->x1, clip_x0, clip_x1), draw_limit(rect->y1, clip_y0, clip_y1));
+			drawn++;
+		}
+	}
+	draw_end();
+	return drawn;
+}
+
+
+/* width is the line-width in 1/16 pixel */
+uint16_t EVE_draw_lines_burst(const EVE_rect *lines, uint16_t count, uint16_t width, uint32_t color)
+{
+	int16_t margin = (int16_t) ((width + 15U) / 16U);
+	uint16_t index;
+	uint16_t drawn = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		const EVE_rect *line = &lines[index];
+
+		if(draw_visible(line->x0, line->y0, line->x1, line->y1, margin))
+		{
+			draw_begin(EVE_LINES, LINE_WIDTH(width), color);
+			draw_vertex(line->x0, line->y0);
+			draw_vertex(line->x1, line->y1);
+			drawn++;
+		}
+	}
+	draw_end();
+	return drawn;
+}
+
+
+/* segments that are not visible are left out, the strip is started again with BEGIN after a gap */
+uint16_t EVE_draw_line_strip_burst(const EVE_point *points, uint16_t count, uint16_t width, uint32_t color)
+{
+	int16_t margin = (int16_t) ((width + 15U) / 16U);
+	uint16_t index;
+	uint16_t drawn = 0;
+	uint8_t connected = 0; /* the last point was sent */
+
+	for(index = 1; index < count; index++)
+	{
+		const EVE_point *from = &points[index - 1U];
+		const EVE_point *to = &points[index];
+
+		if(draw_visible(from->x, from->y, to->x, to->y, margin))
+		{
+			if(connected == 0)
+			{
+				if(draw_started != 0)
+				{
+					spi_transmit_burst(DL_BEGIN | EVE_LINE_STRIP);
+				}
+				draw_begin(EVE_LINE_STRIP, LINE_WIDTH(width), color);
+				draw_vertex(from->x, from->y);
+			}
+			draw_vertex(to->x, to->y);
+			connected = 42;
+			drawn++;
+		}
+		else
+		{
+			connected = 0;
+		}
+	}
+	draw_end();
+	return drawn;
+}
+
+
+/* size is the radius in 1/16 pixel */
+uint16_t EVE_draw_points_burst(const EVE_point *points, uint16_t count, uint16_t size, uint32_t color)
+{
+	int16_t margin = (int16_t) ((size + 15U) / 16U);
+	uint16_t index;
+	uint16_t drawn = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		const EVE_point *point = &points[index];
+
+		if(draw_visible(point->x, point->y, point->x, point->y, margin))
+		{
+			draw_begin(EVE_POINTS, POINT_SIZE(size), color);
+			draw_vertex(point->x, point->y);
+			drawn++;
+		}
+	}
+	draw_end();
+	return drawn;
+}
+
+#endif /* EVE_NO_BURST */
@@ -0,0 +1,91 @@
+/*
+@file    EVE_draw.h
+@brief   drawing arrays of points, lines and rectangles with one BEGIN and culling on the host
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Drawing a track map or a sensor overlay with one EVE_cmd_dl_burst(VERTEX2F(...)) per vertex and BEGIN / END
+around every primitive wastes space in the display-list and time on the host.
+The functions in this module take arrays, emit COLOR_RGB and BEGIN once, skip everything that is outside of the clip area
+and send the vertices in a tight loop.
+
+static const EVE_point track[] = {{12, 80}, {40, 62}, ...};
+static EVE_rect bars[8];
+
+EVE_draw_scissor_burst(0, 40, 480, 200); <- SCISSOR_XY / SCISSOR_SIZE and the clip area for the culling
+EVE_draw_line_strip_burst(track, sizeof(track) / sizeof(track[0]), 32, 0x00ff00UL);
+EVE_draw_rects_burst(bars, 8, 0x2050a0UL);
+EVE_draw_points_burst(cars, car_count, 80, 0xff0000UL);
+EVE_draw_reset_clip_burst();
+
+Coordinates are in pixels.
+A vertex that fits into 0...511 is sent as VERTEX2II, all others are sent as VERTEX2F with VERTEX_FORMAT(0)
+which allows -16384...16383, VERTEX_FORMAT(4) is restored when the function returns.
+Rectangles are cut to the clip area so these can not overflow, lines are not cut as this would change their slope.
+The clip area is not affected by VERTEX_TRANSLATE_X / VERTEX_TRANSLATE_Y, it needs to be set in translated coordinates.
+EVE_draw_set_clip() only sets the clip area for the culling, for when the scissor is set by other means.
+The functions return the number of primitives that were sent, with none visible nothing is sent at all.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_DRAW_H_
+#define EVE_DRAW_H_
+
+#include "EVE_commands.h"
+
+#if !defined (EVE_NO_BURST)
+
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+} EVE_point;
+
+typedef struct
+{
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+} EVE_rect; /* also used for lines, from x0 / y0 to x1 / y1 */
+
+void EVE_draw_set_clip(int16_t x, int16_t y, uint16_t w, uint16_t h);
+void EVE_draw_scissor_burst(int16_t x, int16_t y, uint16_t w, uint16_t h);
+void EVE_draw_reset_clip_burst(void);
+
+uint16_t EVE_draw_rects_burst(const EVE_rect *rects, uint16_t count, uint32_t color);
+uint16_t EVE_draw_lines_burst(const EVE_rect *lines, uint16_t count, uint16_t width, uint32_t color);
+uint16_t EVE_draw_line_strip_burst(const EVE_point *points, uint16_t count, uint16_t width, uint32_t color);
+uint16_t EVE_draw_points_burst(const EVE_point *points, uint16_t count, uint16_t size, uint32_t color);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_DRAW_H_ */
@@ -0,0 +1,98 @@
+/*
+@file    EVE_flashdl.c
+@brief   static display-list segments in the flash attached to BT815 / BT816 / BT817 / BT818, added with CMD_APPENDF
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_flashdl.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_flashdl.h"
+
+#if EVE_GEN > 2
+
+static const EVE_flashdl_entry *flashdl_table;
+static uint8_t flashdl_count;
+
+
+/* the table is generated by tools/flashdl.py, it is not copied */
+void EVE_flashdl_init(const EVE_flashdl_entry *table, uint8_t count)
+{
+	flashdl_table = table;
+	flashdl_count = count;
+}
+
+
+/* returns 1 if the flash is in full-speed mode, CMD_APPENDF does not work otherwise */
+uint8_t EVE_flashdl_ready(void)
+{
+	return (EVE_memRead8(REG_FLASH_STATUS) == 3U) ? 1 : 0; /* FLASH_STATUS_FULL */
+}
+
+
+/* read the segment to scratch in RAM_G and check it against the crc from the table, returns 1 if it matches */
+uint8_t EVE_flashdl_verify(uint8_t id, uint32_t scratch)
+{
+	if((id >= flashdl_count) || !EVE_flashdl_ready())
+	{
+		return 0;
+	}
+
+	EVE_cmd_flashread(scratch, flashdl_table[id].address, flashdl_table[id].size);
+	return (EVE_cmd_memcrc(scratch, flashdl_table[id].size) == flashdl_table[id].crc) ? 1 : 0;
+}
+
+
+#if !defined (EVE_BURST_ONLY)
+
+void EVE_flashdl_append(uint8_t id)
+{
+	if(id < flashdl_count)
+	{
+		EVE_cmd_appendf(flashdl_table[id].address, flashdl_table[id].size);
+	}
+}
+
+#endif /* EVE_BURST_ONLY */
+
+
+#if !defined (EVE_NO_BURST)
+
+void EVE_flashdl_append_burst(uint8_t id)
+{
+	if(id < flashdl_count)
+	{
+		EVE_cmd_appendf_burst(flashdl_table[id].address, flashdl_table[id].size);
+	}
+}
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_GEN > 2 */
@@ -0,0 +1,92 @@
+/*
+@file    EVE_flashdl.h
+@brief   static display-list segments in the flash attached to BT815 / BT816 / BT817 / BT818, added with CMD_APPENDF
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Static parts of display-lists can be stored in the external flash instead of the flash of the host controller.
+They are added to a frame with CMD_APPENDF, straight from the flash, without using RAM_G and without uploading anything.
+
+tools/flashdl.py builds a binary for the flash from the display-list words of each segment, plus a header with the ids
+and a table of addresses, sizes and crcs:
+
+python3 tools/flashdl.py --base 0x100000 -o dl_library.bin --header dl_library.h background=background.bin gauge_face=gauge.txt
+
+dl_library.bin has to be written to the flash at the address given with --base, with EVE Asset Builder
+or with EVE_cmd_flashupdate(), then:
+
+#include "dl_library.h"
+
+EVE_init_flash();
+EVE_flashdl_init(DL_LIB_TABLE, DL_LIB_COUNT);
+
+and in the frame:
+
+EVE_flashdl_append_burst(DL_LIB_BACKGROUND);
+
+CMD_APPENDF needs the flash in full-speed mode, EVE_flashdl_ready() checks this.
+
+When the flash also holds fonts, images and audio tools/eve_flash.py lays out the whole flash image from a manifest,
+the segments of type "dl" get the same kind of table there, PREFIX_DL_TABLE and PREFIX_DL_COUNT.
+EVE_flashdl_verify() reads a segment into RAM_G with CMD_FLASHREAD and compares the crc with the one from the table,
+this is meant to check once after an update of the flash that the binary and the header belong together.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_FLASHDL_H_
+#define EVE_FLASHDL_H_
+
+#include "EVE_commands.h"
+
+#if EVE_GEN > 2
+
+typedef struct
+{
+	uint32_t address; /* in the flash, 64 byte aligned */
+	uint32_t size;    /* in bytes */
+	uint32_t crc;     /* CRC-32 as returned by CMD_MEMCRC */
+} EVE_flashdl_entry;
+
+void EVE_flashdl_init(const EVE_flashdl_entry *table, uint8_t count);
+uint8_t EVE_flashdl_ready(void);
+uint8_t EVE_flashdl_verify(uint8_t id, uint32_t scratch);
+
+#if !defined (EVE_BURST_ONLY)
+void EVE_flashdl_append(uint8_t id);
+#endif
+
+#if !defined (EVE_NO_BURST)
+void EVE_flashdl_append_burst(uint8_t id);
+#endif
+
+#endif /* EVE_GEN > 2 */
+
+#endif /* EVE_FLASHDL_H_ */
@@ -0,0 +1,522 @@
+/*
+@file    EVE_host.c
+@brief   multi-threaded frame pipeline for EVE displays attached to Linux hosts
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_host.h for how to use this.
+
+The queues between the stages are bounded multi-producer / multi-consumer rings with a sequence counter per slot.
+Putting something in or taking something out is lock-free, two counting semaphores per queue only put a thread to sleep
+when there is nothing to take or no room to put, with futex based semaphores this does not enter the kernel otherwise.
+The frame buffers are allocated once and travel from the free queue thru the build threads, the serializer and the transport
+thread back to the free queue, nothing is copied on the way.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- EVE_host_frame_end() restores EVE_dma_buffer of the calling thread
+- EVE_host_stop() destroys the semaphores of the queues that EVE_host_start() initialises
+
+*/
+
+#if !defined (_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* clock_gettime() and nanosleep() with -std=c99 */
+#endif
+
+#include "EVE_host.h"
+#include "EVE_commands_private.h"
+
+#if defined (EVE_HOST)
+
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <time.h>
+
+#define EVE_HOST_QUEUE (EVE_HOST_FRAMES * 2U) /* room for all frames plus the end marker */
+#define EVE_HOST_MAX_BURSTS (((EVE_HOST_FRAME_WORDS * 4U) / EVE_HOST_BURST_BYTES) + 1U)
+
+typedef struct
+{
+	uint32_t words[EVE_HOST_FRAME_WORDS];
+	uint32_t sequence;
+	uint32_t started; /* time stamp from EVE_host_frame_begin() */
+	uint16_t count; /* words used including words[0] */
+	uint16_t bursts;
+	uint16_t burst_end[EVE_HOST_MAX_BURSTS]; /* index behind the last word of each burst */
+} host_frame;
+
+typedef struct
+{
+	uint32_t sequence;
+	host_frame *frame;
+} host_cell;
+
+typedef struct
+{
+	host_cell cell[EVE_HOST_QUEUE];
+	uint32_t head;
+	uint32_t tail;
+	sem_t items;
+	sem_t spaces;
+} host_queue;
+
+static host_frame frames[EVE_HOST_FRAMES];
+static host_queue free_queue; /* frame buffers that can be used by the build threads */
+static host_queue built_queue; /* build threads to serializer */
+static host_queue send_queue; /* serializer to transport */
+
+static pthread_t serializer_thread;
+static pthread_t transport_thread;
+static pthread_t status_thread;
+static pthread_mutex_t fifo_lock = PTHREAD_MUTEX_INITIALIZER; /* transport thread vs. fault recovery by the status thread */
+
+static __thread host_frame *building; /* the frame the calling thread is building */
+static __thread uint32_t *building_saved; /* EVE_dma_buffer of the calling thread outside of a frame */
+static uint32_t next_sequence;
+static uint8_t running;
+
+static EVE_host_stats stats;
+static EVE_host_status status;
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- helpers ---------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+static uint32_t host_micros(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t) ((now.tv_sec * 1000000UL) + (now.tv_nsec / 1000L));
+}
+
+static void host_sleep_us(uint32_t us)
+{
+	struct timespec delay;
+
+	delay.tv_sec = us / 1000000UL;
+	delay.tv_nsec = (long) (us % 1000000UL) * 1000L;
+	nanosleep(&delay, NULL);
+}
+
+static void host_count(uint32_t *counter, uint32_t amount)
+{
+	__atomic_fetch_add(counter, amount, __ATOMIC_RELAXED);
+}
+
+static void host_set(uint32_t *value, uint32_t amount)
+{
+	__atomic_store_n(value, amount, __ATOMIC_RELAXED);
+}
+
+
+static void queue_init(host_queue *queue)
+{
+	uint32_t index;
+
+	for(index = 0; index < EVE_HOST_QUEUE; index++)
+	{
+		queue->cell[index].sequence = index;
+	}
+	queue->head = 0;
+	queue->tail = 0;
+	sem_init(&queue->items, 0, 0);
+	sem_init(&queue->spaces, 0, EVE_HOST_QUEUE);
+}
+
+
+/* EVE_host_start() initialises the semaphores again */
+static void queue_destroy(host_queue *queue)
+{
+	sem_destroy(&queue->items);
+	sem_destroy(&queue->spaces);
+}
+
+
+/* blocks while the queue is full */
+static void queue_push(host_queue *queue, host_frame *frame)
+{
+	host_cell *cell;
+	uint32_t pos;
+	int32_t diff;
+
+	while(sem_wait(&queue->spaces) != 0) /* interrupted by a signal */
+	{
+	}
+
+	pos = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+	for(;;)
+	{
+		cell = &queue->cell[pos & (EVE_HOST_QUEUE - 1U)];
+		diff = (int32_t) (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - pos);
+
+		if((diff == 0) && __atomic_compare_exchange_n(&queue->head, &pos, pos + 1U, 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+		if(diff < 0)
+		{
+			sched_yield(); /* a consumer claimed the slot but did not release it yet */
+		}
+		if(diff != 0)
+		{
+			pos = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+		}
+	}
+
+	cell->frame = frame;
+	__atomic_store_n(&cell->sequence, pos + 1U, __ATOMIC_RELEASE);
+	sem_post(&queue->items);
+}
+
+
+/* blocks while the queue is empty */
+static host_frame *queue_pop(host_queue *queue)
+{
+	host_cell *cell;
+	host_frame *frame;
+	uint32_t pos;
+	int32_t diff;
+
+	while(sem_wait(&queue->items) != 0)
+	{
+	}
+
+	pos = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+	for(;;)
+	{
+		cell = &queue->cell[pos & (EVE_HOST_QUEUE - 1U)];
+		diff = (int32_t) (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - (pos + 1U));
+
+		if((diff == 0) && __atomic_compare_exchange_n(&queue->tail, &pos, pos + 1U, 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+		if(diff < 0)
+		{
+			sched_yield(); /* a producer claimed the slot but did not publish it yet */
+		}
+		if(diff != 0)
+		{
+			pos = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+		}
+	}
+
+	frame = cell->frame;
+	__atomic_store_n(&cell->sequence, pos + EVE_HOST_QUEUE, __ATOMIC_RELEASE);
+	sem_post(&queue->spaces);
+	return frame;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- stages ----------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+/* split a frame into bursts of up to EVE_HOST_BURST_BYTES */
+static void serialize(host_frame *frame)
+{
+	uint16_t index = 1;
+
+	frame->bursts = 0;
+	while(index < frame->count)
+	{
+		index += (EVE_HOST_BURST_BYTES / 4U);
+		if(index > frame->count)
+		{
+			index = frame->count;
+		}
+		frame->burst_end[frame->bursts++] = index;
+	}
+}
+
+
+/* the serializer restores the order the frames were started in, build threads can finish them in any order */
+static void *serializer_task(void *parameter)
+{
+	host_frame *pending[EVE_HOST_FRAMES] = {0};
+	host_frame *frame;
+	uint32_t expected = 0;
+	uint32_t start;
+
+	(void) parameter;
+
+	for(;;)
+	{
+		frame = queue_pop(&built_queue);
+		if(frame == NULL)
+		{
+			queue_push(&send_queue, NULL);
+			return NULL;
+		}
+
+		start = host_micros();
+		pending[frame->sequence & (EVE_HOST_FRAMES - 1U)] = frame; /* there are never more than EVE_HOST_FRAMES frames in flight */
+
+		while(pending[expected & (EVE_HOST_FRAMES - 1U)] != NULL)
+		{
+			frame = pending[expected & (EVE_HOST_FRAMES - 1U)];
+			pending[expected & (EVE_HOST_FRAMES - 1U)] = NULL;
+			serialize(frame);
+			queue_push(&send_queue, frame);
+			expected++;
+		}
+		host_set(&stats.serialize_us, host_micros() - start);
+	}
+}
+
+
+/* wait until there is room for "bytes" in the command-fifo, returns the micro-seconds spent waiting */
+static uint32_t transport_wait(uint32_t bytes)
+{
+	uint32_t start = host_micros();
+	uint16_t space;
+
+	for(;;)
+	{
+		space = EVE_memRead16(REG_CMDB_SPACE);
+		if((space & 0x3U) != 0) /* fault, EVE_busy() makes the co-processor play with us again */
+		{
+			EVE_busy();
+		}
+		else if(space >= bytes)
+		{
+			break;
+		}
+		else
+		{
+			host_sleep_us(100);
+		}
+	}
+	return host_micros() - start;
+}
+
+
+static void *transport_task(void *parameter)
+{
+	host_frame *frame;
+	uint32_t start;
+	uint32_t waited;
+	uint32_t bytes;
+	uint16_t first;
+	uint16_t burst;
+
+	(void) parameter;
+
+	for(;;)
+	{
+		frame = queue_pop(&send_queue);
+		if(frame == NULL)
+		{
+			return NULL;
+		}
+
+		start = host_micros();
+		waited = 0;
+		first = 1;
+		for(burst = 0; burst < frame->bursts; burst++)
+		{
+			bytes = (frame->burst_end[burst] - first) * 4U;
+
+			pthread_mutex_lock(&fifo_lock);
+			waited += transport_wait(bytes);
+			EVE_cs_set();
+			spi_transmit((uint8_t)(REG_CMDB_WRITE >> 16) | MEM_WRITE);
+			spi_transmit((uint8_t)(REG_CMDB_WRITE >> 8));
+			spi_transmit((uint8_t)(REG_CMDB_WRITE));
+			spi_transmit_buffer((const uint8_t *) &frame->words[first], bytes); /* little-endian host, same byte order as spi_transmit_32() */
+			EVE_cs_clear();
+			pthread_mutex_unlock(&fifo_lock);
+
+			host_count(&stats.bytes, bytes);
+			first = frame->burst_end[burst];
+		}
+
+		host_count(&stats.bursts, frame->bursts);
+		host_set(&stats.wait_us, waited);
+		host_set(&stats.transport_us, host_micros() - start);
+		host_count(&stats.frames_sent, 1U);
+		queue_push(&free_queue, frame);
+	}
+}
+
+
+static void *status_task(void *parameter)
+{
+	uint32_t start;
+	uint16_t space;
+
+	(void) parameter;
+
+	while(__atomic_load_n(&running, __ATOMIC_ACQUIRE))
+	{
+		start = host_micros();
+		__atomic_store_n(&status.touch_tag, EVE_memRead8(REG_TOUCH_TAG), __ATOMIC_RELAXED);
+		__atomic_store_n(&status.touch_xy, EVE_memRead32(REG_TOUCH_SCREEN_XY), __ATOMIC_RELAXED);
+
+		space = EVE_memRead16(REG_CMDB_SPACE);
+		__atomic_store_n(&status.fault, ((space & 0x3U) != 0) ? 1 : 0, __ATOMIC_RELAXED);
+		if((space & 0x3U) != 0)
+		{
+			host_count(&stats.faults, 1U);
+			pthread_mutex_lock(&fifo_lock); /* recover right away instead of with the next frame */
+			EVE_busy();
+			pthread_mutex_unlock(&fifo_lock);
+		}
+
+		host_set(&stats.status_us, host_micros() - start);
+		host_sleep_us(EVE_HOST_STATUS_MS * 1000UL);
+	}
+	return NULL;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- public functions ------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+/* EVE_init() has to be done before, returns 1 on success */
+uint8_t EVE_host_start(void)
+{
+	uint32_t index;
+
+	queue_init(&free_queue);
+	queue_init(&built_queue);
+	queue_init(&send_queue);
+
+	for(index = 0; index < EVE_HOST_FRAMES; index++)
+	{
+		queue_push(&free_queue, &frames[index]);
+	}
+
+	next_sequence = 0;
+	__atomic_store_n(&running, 1, __ATOMIC_RELEASE);
+
+	if((pthread_create(&serializer_thread, NULL, serializer_task, NULL) != 0) ||
+		(pthread_create(&transport_thread, NULL, transport_task, NULL) != 0) ||
+		(pthread_create(&status_thread, NULL, status_task, NULL) != 0))
+	{
+		return 0;
+	}
+	return 1;
+}
+
+
+/* wait until every frame that was ended is sent */
+void EVE_host_flush(void)
+{
+	while(__atomic_load_n(&stats.frames_sent, __ATOMIC_ACQUIRE) != __atomic_load_n(&stats.frames_built, __ATOMIC_ACQUIRE))
+	{
+		host_sleep_us(500);
+	}
+}
+
+
+/* sends what is left and ends the threads, no build thread may be between EVE_host_frame_begin() and EVE_host_frame_end() */
+void EVE_host_stop(void)
+{
+	EVE_host_flush();
+	__atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+	queue_push(&built_queue, NULL); /* the end marker passes thru the serializer to the transport thread */
+	pthread_join(serializer_thread, NULL);
+	pthread_join(transport_thread, NULL);
+	pthread_join(status_thread, NULL);
+
+	queue_destroy(&free_queue);
+	queue_destroy(&built_queue);
+	queue_destroy(&send_queue);
+}
+
+
+/* take a free frame buffer and point EVE_dma_buffer of the calling thread to it, blocks while all buffers are in use */
+/* EVE_host_frame_end() points EVE_dma_buffer back to where it was before */
+uint8_t EVE_host_frame_begin(void)
+{
+	uint32_t ftAddress = REG_CMDB_WRITE;
+	int free_buffers = 0;
+
+	if(!__atomic_load_n(&running, __ATOMIC_ACQUIRE))
+	{
+		return 0;
+	}
+
+	sem_getvalue(&free_queue.items, &free_buffers);
+	if(free_buffers <= 0)
+	{
+		host_count(&stats.stalls, 1U);
+	}
+
+	building = queue_pop(&free_queue);
+	building->sequence = __atomic_fetch_add(&next_sequence, 1U, __ATOMIC_RELAXED);
+	building->started = host_micros();
+
+	building_saved = EVE_dma_buffer;
+	EVE_dma_buffer = building->words;
+	/* 0x low mid hi 00 */
+	EVE_dma_buffer[0] = ((uint8_t)(ftAddress >> 16) | MEM_WRITE) | (ftAddress & 0x0000ff00) |  ((uint8_t)(ftAddress) << 16);
+	EVE_dma_buffer[0] = EVE_dma_buffer[0] << 8;
+	EVE_dma_buffer_index = 1;
+	return 1;
+}
+
+
+void EVE_host_frame_end(void)
+{
+	building->count = EVE_dma_buffer_index;
+	EVE_dma_buffer = building_saved; /* the frame buffer belongs to the serializer now */
+	host_set(&stats.build_us, host_micros() - building->started);
+	host_count(&stats.frames_built, 1U);
+	queue_push(&built_queue, building);
+	building = NULL;
+}
+
+
+void EVE_host_get_stats(EVE_host_stats *result)
+{
+	__atomic_load(&stats.frames_built, &result->frames_built, __ATOMIC_RELAXED);
+	__atomic_load(&stats.frames_sent, &result->frames_sent, __ATOMIC_RELAXED);
+	__atomic_load(&stats.bursts, &result->bursts, __ATOMIC_RELAXED);
+	__atomic_load(&stats.bytes, &result->bytes, __ATOMIC_RELAXED);
+	__atomic_load(&stats.stalls, &result->stalls, __ATOMIC_RELAXED);
+	__atomic_load(&stats.faults, &result->faults, __ATOMIC_RELAXED);
+	__atomic_load(&stats.build_us, &result->build_us, __ATOMIC_RELAXED);
+	__atomic_load(&stats.serialize_us, &result->serialize_us, __ATOMIC_RELAXED);
+	__atomic_load(&stats.transport_us, &result->transport_us, __ATOMIC_RELAXED);
+	__atomic_load(&stats.wait_us, &result->wait_us, __ATOMIC_RELAXED);
+	__atomic_load(&stats.status_us, &result->status_us, __ATOMIC_RELAXED);
+}
+
+
+void EVE_host_get_status(EVE_host_status *result)
+{
+	result->touch_xy = __atomic_load_n(&status.touch_xy, __ATOMIC_RELAXED);
+	result->touch_tag = __atomic_load_n(&status.touch_tag, __ATOMIC_RELAXED);
+	result->fault = __atomic_load_n(&status.fault, __ATOMIC_RELAXED);
+}
+
+#endif /* EVE_HOST */
@@ -0,0 +1,140 @@
+/*
+@file    EVE_host.h
+@brief   multi-threaded frame pipeline for EVE displays attached to Linux hosts
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+On a single board computer one thread alternating between building a frame and waiting for the SPI and the co-processor
+wastes most of the CPU time it has, EVE_host.c splits this up into four stages:
+- build threads: any number of application threads build frames with the EVE_cmd_xxx_burst() functions
+- serializer: puts the frames back into the order they were started in and splits them into bursts
+- transport: waits for space in the command-fifo and sends the bursts, this thread does the SPI writes for the frames
+- status: polls touch and the co-processor fault state every EVE_HOST_STATUS_MS
+
+The stages are connected by bounded lock-free queues, a thread only sleeps when its queue is empty or full.
+
+Usage:
+- EVE_init_spi() or EVE_init_capture() and EVE_init() as usual
+- EVE_host_start()
+- in one or more threads:
+
+if(EVE_host_frame_begin())
+{
+	EVE_cmd_dl_burst(CMD_DLSTART);
+	...
+	EVE_cmd_dl_burst(CMD_SWAP);
+	EVE_host_frame_end();
+}
+
+- EVE_host_stop() waits for all frames to be sent and ends the threads
+
+A frame can be up to EVE_HOST_FRAME_WORDS long, more than fits into the command-fifo, the transport thread sends it
+in bursts of up to EVE_HOST_BURST_BYTES.
+EVE_host_get_stats() returns counters and the micro-seconds the stages took for the last frame,
+like num_profile_a / num_profile_b in the examples.
+This needs a target with a thread-local EVE_dma_buffer and spi_transmit_buffer(), like the Linux target in EVE_target.h.
+Every thread has a DMA buffer of its own there, EVE_host_frame_end() points EVE_dma_buffer back to it.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_HOST_H_
+#define EVE_HOST_H_
+
+#include "EVE_commands.h"
+
+#if defined (EVE_HOST)
+
+#if !defined (EVE_DMA)
+#error "EVE_HOST needs EVE_DMA"
+#endif
+
+/* number of frame buffers, needs to be a power of two */
+#if !defined (EVE_HOST_FRAMES)
+#define EVE_HOST_FRAMES 8U
+#endif
+
+/* size of a frame buffer in 32 bit words, the first word is reserved for the address like with EVE_dma_buffer */
+#if !defined (EVE_HOST_FRAME_WORDS)
+#define EVE_HOST_FRAME_WORDS 8192U
+#endif
+
+/* the transport thread waits for this much space in the command-fifo before it sends, max. 4092 */
+#if !defined (EVE_HOST_BURST_BYTES)
+#define EVE_HOST_BURST_BYTES 2048U
+#endif
+
+#if !defined (EVE_HOST_STATUS_MS)
+#define EVE_HOST_STATUS_MS 10U
+#endif
+
+#if (EVE_HOST_FRAMES & (EVE_HOST_FRAMES - 1U)) != 0
+#error "EVE_HOST_FRAMES needs to be a power of two"
+#endif
+
+#if (EVE_HOST_BURST_BYTES > 4092U) || ((EVE_HOST_BURST_BYTES & 3U) != 0)
+#error "EVE_HOST_BURST_BYTES needs to be a multiple of four and not more than 4092"
+#endif
+
+typedef struct
+{
+	uint32_t frames_built;
+	uint32_t frames_sent;
+	uint32_t bursts;
+	uint32_t bytes;
+	uint32_t stalls;       /* EVE_host_frame_begin() had to wait for a free frame buffer */
+	uint32_t faults;       /* co-processor faults seen by the status thread */
+	uint32_t build_us;     /* EVE_host_frame_begin() to EVE_host_frame_end() for the last frame */
+	uint32_t serialize_us; /* time the serializer spent on the last frame */
+	uint32_t transport_us; /* time the transport thread spent on the last frame, including waiting for space */
+	uint32_t wait_us;      /* part of transport_us that was spent waiting for space in the command-fifo */
+	uint32_t status_us;    /* time the last status poll took */
+} EVE_host_stats;
+
+typedef struct
+{
+	uint32_t touch_xy;  /* REG_TOUCH_SCREEN_XY */
+	uint8_t touch_tag;  /* REG_TOUCH_TAG */
+	uint8_t fault;      /* the last poll found the co-processor in fault state */
+} EVE_host_status;
+
+uint8_t EVE_host_start(void);
+void EVE_host_stop(void);
+void EVE_host_flush(void);
+
+uint8_t EVE_host_frame_begin(void);
+void EVE_host_frame_end(void);
+
+void EVE_host_get_stats(EVE_host_stats *stats);
+void EVE_host_get_status(EVE_host_status *status);
+
+#endif /* EVE_HOST */
+
+#endif /* EVE_HOST_H_ */
@@ -0,0 +1,332 @@
+/*
+@file    EVE_list.c
+@brief   BT817 / BT818 cache for display-list subroutines built with CMD_NEWLIST and called with CMD_CALLLIST
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_list.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_list.h"
+#include "EVE_commands_private.h"
+
+#if EVE_GEN > 3
+
+typedef struct
+{
+	EVE_list_function build;
+	uint32_t hash;
+	uint32_t address;
+	uint32_t last_used; /* number of the frame the list was called in last */
+	uint16_t size;
+	uint8_t slot;  /* first slot */
+	uint8_t slots; /* number of slots, 0 for an unused entry */
+} eve_list;
+
+static eve_list lists[EVE_LIST_MAX];
+static uint8_t slot_owner[EVE_LIST_SLOTS];
+static uint8_t slot_count;
+static uint32_t list_base;
+static uint32_t list_frame = 2; /* lists used in this or the last frame are not evicted */
+static EVE_list_stats list_stats;
+
+
+/* FNV-1a over the address of the function and the context */
+static uint32_t list_hash(EVE_list_function build, const void *data, uint16_t size)
+{
+	uintptr_t function = (uintptr_t) build;
+
+	return eve_fnv1a(eve_fnv1a(EVE_FNV1A_INIT, &function, sizeof(function)), data, size);
+}
+
+
+/* a list used in this or the last frame can still be called by a frame that is in the command-fifo or in the DMA buffer */
+static uint8_t list_in_use(uint8_t id)
+{
+	return ((list_frame - lists[id].last_used) < 2U) ? 1 : 0;
+}
+
+
+static void list_evict(uint8_t id)
+{
+	uint8_t slot;
+
+	for(slot = lists[id].slot; slot < (lists[id].slot + lists[id].slots); slot++)
+	{
+		slot_owner[slot] = EVE_LIST_NONE;
+	}
+	lists[id].slots = 0;
+	list_stats.evictions++;
+}
+
+
+static uint8_t list_find(EVE_list_function build, uint32_t hash, uint16_t size)
+{
+	uint8_t id;
+
+	for(id = 0; id < EVE_LIST_MAX; id++)
+	{
+		if((lists[id].slots != 0) && (lists[id].hash == hash) && (lists[id].build == build) && (lists[id].size == size))
+		{
+			return id;
+		}
+	}
+	return EVE_LIST_NONE;
+}
+
+
+/* find the run of "slots" slots that was used least recently, lists that are still in use can not be evicted */
+static uint8_t list_place(uint8_t slots)
+{
+	uint32_t best_cost = 0xffffffffUL;
+	uint32_t cost;
+	uint8_t best = EVE_LIST_NONE;
+	uint8_t start;
+	uint8_t slot;
+	uint8_t owner;
+
+	for(start = 0; (start + slots) <= slot_count; start++)
+	{
+		cost = 0;
+		for(slot = start; slot < (start + slots); slot++)
+		{
+			owner = slot_owner[slot];
+			if(owner != EVE_LIST_NONE)
+			{
+				if(list_in_use(owner))
+				{
+					break;
+				}
+				if((lists[owner].last_used + 1U) > cost)
+				{
+					cost = lists[owner].last_used + 1U;
+				}
+			}
+		}
+
+		if((slot == (start + slots)) && (cost < best_cost))
+		{
+			best_cost = cost;
+			best = start;
+			if(cost == 0) /* all free */
+			{
+				break;
+			}
+		}
+	}
+	return best;
+}
+
+
+/* get an entry and slots for a new list, returns EVE_LIST_NONE if everything is in use */
+/* nothing is evicted before the slots for the list were found */
+static uint8_t list_allocate(uint16_t max_bytes)
+{
+	uint8_t slots;
+	uint8_t start;
+	uint8_t slot;
+	uint8_t id;
+	uint8_t oldest = EVE_LIST_NONE;
+
+	if((max_bytes == 0) || (max_bytes > (slot_count * EVE_LIST_SLOT))) /* without a size the list could overwrite the next one */
+	{
+		return EVE_LIST_NONE;
+	}
+	slots = (uint8_t) ((max_bytes + EVE_LIST_SLOT - 1U) / EVE_LIST_SLOT);
+
+	for(id = 0; id < EVE_LIST_MAX; id++) /* a free entry or the one used least recently */
+	{
+		if(lists[id].slots == 0)
+		{
+			break;
+		}
+		if(!list_in_use(id) && ((oldest == EVE_LIST_NONE) || (lists[id].last_used < lists[oldest].last_used)))
+		{
+			oldest = id;
+		}
+	}
+
+	if((id == EVE_LIST_MAX) && (oldest == EVE_LIST_NONE))
+	{
+		return EVE_LIST_NONE;
+	}
+
+	start = list_place(slots);
+	if(start == EVE_LIST_NONE)
+	{
+		return EVE_LIST_NONE;
+	}
+
+	if(id == EVE_LIST_MAX)
+	{
+		id = oldest;
+		list_evict(id);
+	}
+
+	for(slot = start; slot < (start + slots); slot++)
+	{
+		if(slot_owner[slot] != EVE_LIST_NONE)
+		{
+			list_evict(slot_owner[slot]);
+		}
+	}
+
+	for(slot = start; slot < (start + slots); slot++)
+	{
+		slot_owner[slot] = id;
+	}
+	lists[id].slot = start;
+	lists[id].slots = slots;
+	lists[id].address = list_base + ((uint32_t) start * EVE_LIST_SLOT);
+	return id;
+}
+
+
+/* find the list or make room for it, returns EVE_LIST_NONE if it can not be cached */
+static uint8_t list_lookup(EVE_list_function build, void *context, uint16_t size, uint16_t max_bytes, uint8_t *hit)
+{
+	uint32_t hash = list_hash(build, context, size);
+	uint8_t id;
+
+	*hit = 0;
+	id = list_find(build, hash, size);
+	if(id != EVE_LIST_NONE)
+	{
+		*hit = 42;
+		list_stats.hits++;
+	}
+	else
+	{
+		id = list_allocate(max_bytes);
+		if(id == EVE_LIST_NONE)
+		{
+			list_stats.uncached++;
+			return EVE_LIST_NONE;
+		}
+		lists[id].build = build;
+		lists[id].hash = hash;
+		lists[id].size = size;
+		list_stats.misses++;
+	}
+
+	lists[id].last_used = list_frame;
+	return id;
+}
+
+
+/* hand an area of RAM_G to the cache, this forgets all lists */
+void EVE_list_init(uint32_t base, uint32_t size)
+{
+	uint8_t index;
+
+	list_base = (base + 3U) & ~3UL;
+	size -= (list_base - base);
+	size /= EVE_LIST_SLOT;
+	slot_count = (size > EVE_LIST_SLOTS) ? EVE_LIST_SLOTS : (uint8_t) size;
+
+	for(index = 0; index < EVE_LIST_SLOTS; index++)
+	{
+		slot_owner[index] = EVE_LIST_NONE;
+	}
+	for(index = 0; index < EVE_LIST_MAX; index++)
+	{
+		lists[index].slots = 0;
+	}
+}
+
+
+/* to be called once per frame before the first call of a list */
+void EVE_list_frame(void)
+{
+	list_frame++;
+}
+
+
+void EVE_list_get_stats(EVE_list_stats *stats)
+{
+	*stats = list_stats;
+}
+
+
+#if !defined (EVE_BURST_ONLY)
+
+/* call the list for build(context) and build it first if it is not in the cache */
+/* returns the handle of the list or EVE_LIST_NONE if build() was called directly */
+uint8_t EVE_list_call(EVE_list_function build, void *context, uint16_t size, uint16_t max_bytes)
+{
+	uint8_t hit;
+	uint8_t id = list_lookup(build, context, size, max_bytes, &hit);
+
+	if(id == EVE_LIST_NONE)
+	{
+		build(context);
+		return EVE_LIST_NONE;
+	}
+
+	if(!hit)
+	{
+		EVE_cmd_newlist(lists[id].address);
+		build(context);
+		EVE_cmd_dl(CMD_ENDLIST);
+	}
+	EVE_cmd_calllist(lists[id].address);
+	return id;
+}
+
+#endif /* EVE_BURST_ONLY */
+
+
+#if !defined (EVE_NO_BURST)
+
+uint8_t EVE_list_call_burst(EVE_list_function build, void *context, uint16_t size, uint16_t max_bytes)
+{
+	uint8_t hit;
+	uint8_t id = list_lookup(build, context, size, max_bytes, &hit);
+
+	if(id == EVE_LIST_NONE)
+	{
+		build(context);
+		return EVE_LIST_NONE;
+	}
+
+	if(!hit)
+	{
+		EVE_cmd_dl_burst(CMD_NEWLIST);
+		EVE_cmd_dl_burst(lists[id].address);
+		build(context);
+		EVE_cmd_dl_burst(CMD_ENDLIST);
+	}
+	EVE_cmd_calllist_burst(lists[id].address);
+	return id;
+}
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_GEN > 3 */
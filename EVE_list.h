@@ -0,0 +1,116 @@
+/*
+@file    EVE_list.h
+@brief   BT817 / BT818 cache for display-list subroutines built with CMD_NEWLIST and called with CMD_CALLLIST
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Widgets like CMD_BUTTON or CMD_GAUGE make the co-processor generate the same display-list commands every frame
+as long as their parameters stay the same.
+EVE_list_call_burst() compiles what a function builds into a list in RAM_G with CMD_NEWLIST / CMD_ENDLIST the first time
+and only adds CMD_CALLLIST for it from then on.
+The lists are found by a hash over the parameters and the function, when a list is not in the cache it is built
+and called in the same frame, there is no extra round-trip.
+
+typedef struct { int16_t x, y, w, h; uint16_t font, options; const char *text; } button_t;
+
+void draw_button(void *context)
+{
+	button_t *b = (button_t *) context;
+	EVE_cmd_button_burst(b->x, b->y, b->w, b->h, b->font, b->options, b->text);
+}
+
+EVE_list_init(EVE_RAM_G_SIZE - 32768, 32768); <- the budget for all lists
+...
+EVE_list_frame(); <- once for every frame before the first EVE_list_call_burst()
+EVE_list_call_burst(draw_button, &button, sizeof(button), 256);
+
+The RAM_G area is split into slots of EVE_LIST_SLOT bytes, a list takes as many slots as "max_bytes" needs,
+with "max_bytes" 0 the list is not cached and build() is called directly each time.
+The co-processor can not tell how long a list is going to be while it is built, a list that does not fit into its slots
+overwrites the next one, this needs to be taken care of with "max_bytes".
+When there is no space the least recently used list is evicted, lists that were used in this or the last frame
+are kept as a frame that is still in the command-fifo or in the DMA buffer may call them.
+CMD_CALLLIST is only executed when the co-processor gets to it, while the next frame with its CMD_NEWLIST is built already.
+The display-list that is shown does not need the lists anymore, the co-processor copied their commands into RAM_DL.
+The hash is over the bytes of the context so this should not contain pointers to data that changes, a pointer to
+a string that changes for example needs to be a copy of the string instead.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_LIST_H_
+#define EVE_LIST_H_
+
+#include "EVE_commands.h"
+
+#if EVE_GEN > 3
+
+/* max. number of lists in the cache */
+#if !defined (EVE_LIST_MAX)
+#define EVE_LIST_MAX 32U
+#endif
+
+/* size of a slot in RAM_G, needs to be a multiple of four */
+#if !defined (EVE_LIST_SLOT)
+#define EVE_LIST_SLOT 256U
+#endif
+
+/* max. number of slots, the RAM_G area is cut down to this */
+#if !defined (EVE_LIST_SLOTS)
+#define EVE_LIST_SLOTS 128U
+#endif
+
+#define EVE_LIST_NONE 0xffU
+
+typedef void (*EVE_list_function)(void *context);
+
+typedef struct
+{
+	uint32_t hits;
+	uint32_t misses;    /* lists that were built */
+	uint32_t evictions;
+	uint32_t uncached;  /* no room even after eviction, the function was called directly */
+} EVE_list_stats;
+
+void EVE_list_init(uint32_t base, uint32_t size);
+void EVE_list_frame(void);
+void EVE_list_get_stats(EVE_list_stats *stats);
+
+#if !defined (EVE_BURST_ONLY)
+uint8_t EVE_list_call(EVE_list_function build, void *context, uint16_t size, uint16_t max_bytes);
+#endif
+
+#if !defined (EVE_NO_BURST)
+uint8_t EVE_list_call_burst(EVE_list_function build, void *context, uint16_t size, uint16_t max_bytes);
+#endif
+
+#endif /* EVE_GEN > 3 */
+
+#endif /* EVE_LIST_H_ */
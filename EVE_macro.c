@@ -0,0 +1,132 @@
+/*
+@file    EVE_macro.c
+@brief   display-list commands that are changed thru REG_MACRO_0 / REG_MACRO_1
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_macro.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_macro.h"
+
+static uint32_t macro_value[2];
+static uint8_t macro_used[2];
+
+
+/* reserve one of the two macro registers and set it to command, returns the slot for MACRO(slot) or EVE_MACRO_NONE */
+uint8_t EVE_macro_alloc(uint32_t command)
+{
+	uint8_t slot;
+
+	for(slot = 0; slot < 2; slot++)
+	{
+		if(!macro_used[slot])
+		{
+			macro_used[slot] = 42;
+			macro_value[slot] = command;
+			EVE_memWrite32(REG_MACRO_0 + (4UL * slot), command);
+			return slot;
+		}
+	}
+	return EVE_MACRO_NONE;
+}
+
+
+void EVE_macro_free(uint8_t slot)
+{
+	if(slot < 2)
+	{
+		macro_used[slot] = 0;
+	}
+}
+
+
+/* write command to the macro register, nothing is sent if it already holds this command */
+void EVE_macro_set(uint8_t slot, uint32_t command)
+{
+	if((slot < 2) && (macro_value[slot] != command))
+	{
+		macro_value[slot] = command;
+		EVE_memWrite32(REG_MACRO_0 + (4UL * slot), command);
+	}
+}
+
+
+uint32_t EVE_macro_get(uint8_t slot)
+{
+	return (slot < 2) ? macro_value[slot] : DL_NOP;
+}
+
+
+void EVE_macro_color(uint8_t slot, uint32_t color)
+{
+	EVE_macro_set(slot, DL_COLOR_RGB | (color & 0x00ffffffUL));
+}
+
+
+/* everything drawn after the MACRO(slot) is masked off until the color mask is set again */
+void EVE_macro_visible(uint8_t slot, uint8_t visible)
+{
+	EVE_macro_set(slot, visible ? COLOR_MASK(1,1,1,1) : COLOR_MASK(0,0,0,0));
+}
+
+
+/* dest is the number of the 32 bit word in RAM_DL to continue with */
+void EVE_macro_jump(uint8_t slot, uint8_t jump, uint16_t dest)
+{
+	EVE_macro_set(slot, jump ? JUMP(dest) : DL_NOP);
+}
+
+
+void EVE_macro_translate_x(uint8_t slot, int32_t x)
+{
+	EVE_macro_set(slot, VERTEX_TRANSLATE_X((uint32_t) x));
+}
+
+
+void EVE_macro_translate_y(uint8_t slot, int32_t y)
+{
+	EVE_macro_set(slot, VERTEX_TRANSLATE_Y((uint32_t) y));
+}
+
+
+#if !defined (EVE_NO_BURST)
+
+/* same as EVE_macro_set() but as CMD_MEMWRITE in the current cmd-burst */
+void EVE_macro_set_burst(uint8_t slot, uint32_t command)
+{
+	if((slot < 2) && (macro_value[slot] != command))
+	{
+		macro_value[slot] = command;
+		EVE_cmd_memwrite32_burst(REG_MACRO_0 + (4UL * slot), command);
+	}
+}
+
+#endif /* EVE_NO_BURST */
@@ -0,0 +1,83 @@
+/*
+@file    EVE_macro.h
+@brief   display-list commands that are changed thru REG_MACRO_0 / REG_MACRO_1
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+A MACRO(m) command in a display-list executes whatever command is in REG_MACRO_0 or REG_MACRO_1 at the time the list is rendered.
+This allows a display-list, or a cached part of it like a segment from EVE_segment.c, to stay the same
+while one command in it is changed with a single register write, without building the list again and without a swap.
+
+uint8_t alarm = EVE_macro_alloc(DL_COLOR_RGB | RED);
+
+in the display-list:
+EVE_cmd_dl_burst(MACRO(alarm));
+EVE_cmd_text_burst(...);
+
+and to blink:
+EVE_macro_color(alarm, (tick & 1) ? RED : BLACK);
+
+The helpers for the typical uses:
+- EVE_macro_color(): COLOR_RGB
+- EVE_macro_visible(): COLOR_MASK(1,1,1,1) or COLOR_MASK(0,0,0,0), the list has to switch the color mask back on after the part that is hidden
+- EVE_macro_jump(): JUMP to a word in RAM_DL or DL_NOP, the address is only known for lists that were written with EVE_direct.c
+- EVE_macro_translate_x() / EVE_macro_translate_y(): VERTEX_TRANSLATE_X / VERTEX_TRANSLATE_Y in 1/16 pixel
+
+There are only two macro registers, EVE_macro_alloc() returns EVE_MACRO_NONE when both are in use.
+The value of each register is kept so writing the same command again does not cost any SPI traffic.
+EVE_macro_set() uses EVE_memWrite32() and can not be used in a cmd-burst, EVE_macro_set_burst() puts the write into the
+command-fifo with CMD_MEMWRITE so it is executed in order with the rest of the burst.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_MACRO_H_
+#define EVE_MACRO_H_
+
+#include "EVE_commands.h"
+
+#define EVE_MACRO_NONE 0xffU
+
+uint8_t EVE_macro_alloc(uint32_t command);
+void EVE_macro_free(uint8_t slot);
+void EVE_macro_set(uint8_t slot, uint32_t command);
+uint32_t EVE_macro_get(uint8_t slot);
+
+void EVE_macro_color(uint8_t slot, uint32_t color);
+void EVE_macro_visible(uint8_t slot, uint8_t visible);
+void EVE_macro_jump(uint8_t slot, uint8_t jump, uint16_t dest);
+void EVE_macro_translate_x(uint8_t slot, int32_t x);
+void EVE_macro_translate_y(uint8_t slot, int32_t y);
+
+#if !defined (EVE_NO_BURST)
+void EVE_macro_set_burst(uint8_t slot, uint32_t command);
+#endif
+
+#endif /* EVE_MACRO_H_ */
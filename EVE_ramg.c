@@ -0,0 +1,367 @@
+/*
+@file    EVE_ramg.c
+@brief   allocator and memory map for RAM_G
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_ramg.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include <string.h>
+
+#include "EVE_ramg.h"
+
+/* the map, sorted by address and without gaps from area_base to area_base + area_size */
+static EVE_ramg_block ramg_blocks[EVE_RAMG_BLOCKS];
+static uint16_t ramg_count;
+static uint32_t ramg_base;
+static uint32_t ramg_size;
+static uint8_t ramg_level;
+
+
+void EVE_ramg_init(uint32_t base, uint32_t size)
+{
+	ramg_blocks[0].name = NULL;
+	ramg_blocks[0].address = base;
+	ramg_blocks[0].size = size;
+	ramg_blocks[0].level = 0;
+	ramg_count = 1;
+	ramg_base = base;
+	ramg_size = size;
+	ramg_level = 0;
+}
+
+
+/* cuts a region out of the free block at index, returns 0 if the map is full */
+static uint8_t ramg_split(uint16_t index, const char *name, uint32_t address, uint32_t size)
+{
+	EVE_ramg_block *block = &ramg_blocks[index];
+	uint32_t before = address - block->address;
+	uint32_t after = (block->address + block->size) - (address + size);
+	uint16_t insert = (uint16_t) (((before != 0) ? 1U : 0U) + ((after != 0) ? 1U : 0U));
+	uint16_t move;
+
+	if((ramg_count + insert) > EVE_RAMG_BLOCKS)
+	{
+		return 0;
+	}
+
+	for(move = ramg_count; move > (index + 1U); move--)
+	{
+		ramg_blocks[move - 1U + insert] = ramg_blocks[move - 1U];
+	}
+	ramg_count += insert;
+
+	if(before != 0)
+	{
+		block->size = before;
+		index++;
+		block = &ramg_blocks[index];
+	}
+
+	block->name = name;
+	block->address = address;
+	block->size = size;
+	block->level = ramg_level;
+
+	if(after != 0)
+	{
+		block = &ramg_blocks[index + 1U];
+		block->name = NULL;
+		block->address = address + size;
+		block->size = after;
+		block->level = 0;
+	}
+	return 1;
+}
+
+
+/* returns the address or EVE_RAMG_NONE */
+uint32_t EVE_ramg_alloc(const char *name, uint32_t size, uint32_t align)
+{
+	uint16_t index;
+
+	if((size == 0) || (align == 0) || ((align & (align - 1UL)) != 0))
+	{
+		return EVE_RAMG_NONE;
+	}
+	size = (size + 3UL) & ~3UL;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		/* the regions of a page are taken from the top end */
+		uint16_t slot = (ramg_level != 0) ? (uint16_t) (ramg_count - 1U - index) : index;
+		const EVE_ramg_block *block = &ramg_blocks[slot];
+		uint32_t end = block->address + block->size;
+		uint32_t address;
+
+		if((block->name != NULL) || (block->size < size))
+		{
+			continue;
+		}
+
+		if(ramg_level != 0)
+		{
+			address = (end - size) & ~(align - 1UL);
+		}
+		else
+		{
+			address = (block->address + align - 1UL) & ~(align - 1UL);
+		}
+
+		if((address >= block->address) && (address <= end) && ((end - address) >= size))
+		{
+			if(ramg_split(slot, name, address, size) == 0)
+			{
+				return EVE_RAMG_NONE;
+			}
+			return address;
+		}
+	}
+	return EVE_RAMG_NONE;
+}
+
+
+/* takes a region with a fixed address, returns EVE_RAMG_NONE if it overlaps with a region that is already allocated */
+uint32_t EVE_ramg_reserve(const char *name, uint32_t address, uint32_t size)
+{
+	uint16_t index;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		const EVE_ramg_block *block = &ramg_blocks[index];
+
+		if((address >= block->address) && ((address - block->address) < block->size))
+		{
+			if((block->name != NULL) || ((block->size - (address - block->address)) < size) || (size == 0))
+			{
+				return EVE_RAMG_NONE;
+			}
+			if(ramg_split(index, name, address, size) == 0)
+			{
+				return EVE_RAMG_NONE;
+			}
+			return address;
+		}
+	}
+	return EVE_RAMG_NONE;
+}
+
+
+/* marks the block at index as free and merges it with free neighbours */
+static void ramg_release(uint16_t index)
+{
+	uint16_t move;
+
+	ramg_blocks[index].name = NULL;
+	ramg_blocks[index].level = 0;
+
+	if(((index + 1U) < ramg_count) && (ramg_blocks[index + 1U].name == NULL))
+	{
+		ramg_blocks[index].size += ramg_blocks[index + 1U].size;
+		for(move = index + 1U; (move + 1U) < ramg_count; move++)
+		{
+			ramg_blocks[move] = ramg_blocks[move + 1U];
+		}
+		ramg_count--;
+	}
+
+	if((index != 0) && (ramg_blocks[index - 1U].name == NULL))
+	{
+		ramg_blocks[index - 1U].size += ramg_blocks[index].size;
+		for(move = index; (move + 1U) < ramg_count; move++)
+		{
+			ramg_blocks[move] = ramg_blocks[move + 1U];
+		}
+		ramg_count--;
+	}
+}
+
+
+void EVE_ramg_free(uint32_t address)
+{
+	uint16_t index;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		if((ramg_blocks[index].address == address) && (ramg_blocks[index].name != NULL))
+		{
+			ramg_release(index);
+			break;
+		}
+	}
+}
+
+
+uint32_t EVE_ramg_find(const char *name)
+{
+	uint16_t index;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		if((ramg_blocks[index].name != NULL) && (strcmp(ramg_blocks[index].name, name) == 0))
+		{
+			return ramg_blocks[index].address;
+		}
+	}
+	return EVE_RAMG_NONE;
+}
+
+
+/* returns the new level or 0 if there are already EVE_RAMG_LEVELS levels */
+uint8_t EVE_ramg_push(void)
+{
+	if(ramg_level >= EVE_RAMG_LEVELS)
+	{
+		return 0;
+	}
+	ramg_level++;
+	return ramg_level;
+}
+
+
+/* releases all regions that were allocated since the last EVE_ramg_push() */
+void EVE_ramg_pop(void)
+{
+	uint16_t index = 0;
+
+	if(ramg_level == 0)
+	{
+		return;
+	}
+
+	while(index < ramg_count)
+	{
+		if((ramg_blocks[index].name != NULL) && (ramg_blocks[index].level >= ramg_level))
+		{
+			ramg_release(index);
+			index = 0; /* the map was changed */
+		}
+		else
+		{
+			index++;
+		}
+	}
+	ramg_level--;
+}
+
+
+/* returns 1 if address ... address + size - 1 is inside of one allocated region */
+uint8_t EVE_ramg_check(uint32_t address, uint32_t size)
+{
+	uint16_t index;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		const EVE_ramg_block *block = &ramg_blocks[index];
+
+		if((address >= block->address) && ((address - block->address) < block->size))
+		{
+			return ((block->name != NULL) && ((block->size - (address - block->address)) >= size)) ? 1U : 0U;
+		}
+	}
+	return 0;
+}
+
+
+/* returns 1 if the map is sorted, has no gaps or overlaps and covers the whole area */
+uint8_t EVE_ramg_verify(void)
+{
+	uint32_t next = ramg_base;
+	uint16_t index;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		const EVE_ramg_block *block = &ramg_blocks[index];
+
+		if((block->address != next) || (block->size == 0))
+		{
+			return 0;
+		}
+		if((index != 0) && (block->name == NULL) && (ramg_blocks[index - 1U].name == NULL))
+		{
+			return 0; /* free blocks that were not merged */
+		}
+		next += block->size;
+	}
+	return (next == (ramg_base + ramg_size)) ? 1U : 0U;
+}
+
+
+/* for printing the map, returns 0 after the last block */
+uint8_t EVE_ramg_get_block(uint16_t index, EVE_ramg_block *block)
+{
+	if(index >= ramg_count)
+	{
+		return 0;
+	}
+	*block = ramg_blocks[index];
+	return 1;
+}
+
+
+void EVE_ramg_get_stats(EVE_ramg_stats *stats)
+{
+	uint16_t index;
+
+	stats->size = ramg_size;
+	stats->used = 0;
+	stats->free = 0;
+	stats->largest_free = 0;
+	stats->regions = 0;
+	stats->holes = 0;
+	stats->level = ramg_level;
+
+	for(index = 0; index < ramg_count; index++)
+	{
+		const EVE_ramg_block *block = &ramg_blocks[index];
+
+		if(block->name != NULL)
+		{
+			stats->used += block->size;
+			stats->regions++;
+		}
+		else
+		{
+			stats->free += block->size;
+			stats->holes++;
+			if(block->size > stats->largest_free)
+			{
+				stats->largest_free = block->size;
+			}
+		}
+	}
+
+	stats->fragmentation = 0;
+	if(stats->free != 0)
+	{
+		stats->fragmentation = (uint8_t) (((stats->free - stats->largest_free) * 100UL) / stats->free);
+	}
+}
@@ -0,0 +1,114 @@
+/*
+@file    EVE_ramg.h
+@brief   allocator and memory map for RAM_G
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Addresses like MEM_LOGO 0xf8000 that are chosen by hand tend to overlap sooner or later, which shows up as broken images.
+This module hands out named regions of RAM_G instead and keeps a map of what is where.
+Nothing is sent to EVE, this is only book-keeping on the host.
+
+EVE_ramg_init(0, EVE_RAM_G_SIZE);
+EVE_ramg_reserve("dl_static", EVE_RAM_G_SIZE - 4096, 4096); <- a region that has a fixed address
+mem_font = EVE_ramg_alloc("font", sizeof(font), EVE_RAMG_ALIGN_BITMAP);
+mem_logo = EVE_ramg_alloc("logo", sizeof(logo), EVE_RAMG_ALIGN_FLASH); <- target for EVE_cmd_flashread()
+
+and for every page:
+
+EVE_ramg_push();
+mem_map = EVE_ramg_alloc("map", 128000, EVE_RAMG_ALIGN_ASTC);
+...
+EVE_ramg_pop(); <- releases everything that was allocated since EVE_ramg_push() at once
+
+Regions that are allocated after EVE_ramg_push() are taken from the top end of RAM_G while the others are taken
+from the bottom end, so the assets of a page do not leave holes between the regions that stay.
+The alignment needs to be a power of two, EVE_RAMG_ALIGN_xxx are the classes that EVE needs.
+The names are not copied, these need to stay valid, string literals are fine.
+EVE_ramg_check() tells if a range is completely inside of one allocated region, for checking writes in debug builds.
+EVE_ramg_verify() checks the map itself.
+EVE_ramg_get_stats() reports the occupancy and how fragmented the free space is.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_RAMG_H_
+#define EVE_RAMG_H_
+
+#include "EVE_commands.h"
+
+/* max. number of allocated and free regions together */
+#if !defined (EVE_RAMG_BLOCKS)
+#define EVE_RAMG_BLOCKS 48U
+#endif
+
+/* max. number of nested EVE_ramg_push() */
+#if !defined (EVE_RAMG_LEVELS)
+#define EVE_RAMG_LEVELS 4U
+#endif
+
+#define EVE_RAMG_ALIGN_BITMAP 4U  /* bitmaps, display-list segments, CMD_APPEND */
+#define EVE_RAMG_ALIGN_ASTC   16U /* ASTC bitmaps, one block */
+#define EVE_RAMG_ALIGN_FLASH  64U /* CMD_FLASHREAD and CMD_FLASHWRITE */
+
+#define EVE_RAMG_NONE 0xffffffffUL
+
+typedef struct
+{
+	const char *name; /* NULL for free space */
+	uint32_t address;
+	uint32_t size;
+	uint8_t level;    /* 0 for permanent regions, the EVE_ramg_push() level otherwise */
+} EVE_ramg_block;
+
+typedef struct
+{
+	uint32_t size;
+	uint32_t used;
+	uint32_t free;
+	uint32_t largest_free;
+	uint16_t regions;
+	uint16_t holes;         /* number of free blocks */
+	uint8_t fragmentation;  /* percent of the free space that is not in the largest free block */
+	uint8_t level;
+} EVE_ramg_stats;
+
+void EVE_ramg_init(uint32_t base, uint32_t size);
+uint32_t EVE_ramg_alloc(const char *name, uint32_t size, uint32_t align);
+uint32_t EVE_ramg_reserve(const char *name, uint32_t address, uint32_t size);
+void EVE_ramg_free(uint32_t address);
+uint32_t EVE_ramg_find(const char *name);
+uint8_t EVE_ramg_push(void);
+void EVE_ramg_pop(void);
+uint8_t EVE_ramg_check(uint32_t address, uint32_t size);
+uint8_t EVE_ramg_verify(void);
+uint8_t EVE_ramg_get_block(uint16_t index, EVE_ramg_block *block);
+void EVE_ramg_get_stats(EVE_ramg_stats *stats);
+
+#endif /* EVE_RAMG_H_ */
@@ -0,0 +1,201 @@
+/*
+@file    EVE_redraw.c
+@brief   builds and sends a new frame only when something changed
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_redraw.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_redraw.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+typedef struct
+{
+	const uint8_t *data;
+	uint32_t hash;
+	uint16_t size;
+} redraw_binding;
+
+static redraw_binding bindings[EVE_REDRAW_BINDINGS];
+static uint8_t num_bindings;
+static uint32_t redraw_pending = EVE_REDRAW_ALL; /* the first frame is always needed */
+static uint32_t redraw_dirty;
+static uint32_t redraw_inputs = EVE_REDRAW_TOUCH | EVE_REDRAW_TRACKER;
+static uint32_t last_tracker;
+static uint8_t last_tag;
+static EVE_redraw_stats redraw_stats;
+
+#if defined (EVE_DMA)
+static uint32_t last_frame_hash;
+static uint8_t last_frame_valid;
+#endif
+
+
+void EVE_redraw_set_dirty(uint32_t flags)
+{
+	redraw_pending |= flags;
+
+	#if defined (EVE_DMA)
+	if(flags == EVE_REDRAW_ALL)
+	{
+		last_frame_valid = 0; /* send the next frame even if it is the same, the list on screen may be gone */
+	}
+	#endif
+}
+
+
+/* select the inputs that are polled in EVE_redraw_begin(), EVE_REDRAW_TOUCH and / or EVE_REDRAW_TRACKER or 0 */
+void EVE_redraw_set_inputs(uint32_t inputs)
+{
+	redraw_inputs = inputs & (EVE_REDRAW_TOUCH | EVE_REDRAW_TRACKER);
+}
+
+
+/* a frame is built when the data changed, the data has to stay valid, returns 0 when all bindings are in use */
+uint8_t EVE_redraw_bind(const void *data, uint16_t size)
+{
+	if(num_bindings >= EVE_REDRAW_BINDINGS)
+	{
+		return 0;
+	}
+
+	bindings[num_bindings].data = (const uint8_t *) data;
+	bindings[num_bindings].size = size;
+	bindings[num_bindings].hash = eve_fnv1a(EVE_FNV1A_INIT, data, size);
+	num_bindings++;
+	redraw_pending |= EVE_REDRAW_DATA;
+	return 1;
+}
+
+
+static void redraw_poll(void)
+{
+	uint32_t hash;
+	uint8_t index;
+
+	if(redraw_inputs & EVE_REDRAW_TOUCH)
+	{
+		uint8_t tag = EVE_memRead8(REG_TOUCH_TAG);
+
+		if(tag != last_tag)
+		{
+			last_tag = tag;
+			redraw_pending |= EVE_REDRAW_TOUCH;
+		}
+	}
+
+	if(redraw_inputs & EVE_REDRAW_TRACKER)
+	{
+		uint32_t tracker = EVE_memRead32(REG_TRACKER);
+
+		if(tracker != last_tracker)
+		{
+			last_tracker = tracker;
+			redraw_pending |= EVE_REDRAW_TRACKER;
+		}
+	}
+
+	for(index = 0; index < num_bindings; index++)
+	{
+		hash = eve_fnv1a(EVE_FNV1A_INIT, bindings[index].data, bindings[index].size);
+		if(hash != bindings[index].hash)
+		{
+			bindings[index].hash = hash;
+			redraw_pending |= EVE_REDRAW_DATA;
+		}
+	}
+}
+
+
+/* returns 1 and starts a cmd-burst when a frame is needed */
+uint8_t EVE_redraw_begin(void)
+{
+	#if defined (EVE_DMA)
+	if(EVE_dma_busy)
+	{
+		return 0;
+	}
+	#endif
+
+	redraw_stats.checks++;
+	redraw_poll();
+
+	if(redraw_pending == 0)
+	{
+		redraw_stats.unchanged++;
+		return 0;
+	}
+
+	redraw_dirty = redraw_pending;
+	redraw_pending = 0;
+	redraw_stats.frames++;
+	EVE_start_cmd_burst();
+	return 1;
+}
+
+
+void EVE_redraw_end(void)
+{
+	#if defined (EVE_DMA)
+	uint32_t hash;
+
+	hash = eve_fnv1a(EVE_FNV1A_INIT, &EVE_dma_buffer[1], (EVE_dma_buffer_index - 1UL) * 4UL);
+	if(last_frame_valid && (hash == last_frame_hash))
+	{
+		cmd_burst = 0; /* drop the frame, the one on screen is the same */
+		EVE_dma_buffer_index = 0;
+		redraw_stats.identical++;
+		return;
+	}
+	last_frame_hash = hash;
+	last_frame_valid = 42;
+	#endif
+
+	redraw_stats.sent++;
+	EVE_end_cmd_burst();
+}
+
+
+/* the reasons for the current frame */
+uint32_t EVE_redraw_get_dirty(void)
+{
+	return redraw_dirty;
+}
+
+
+void EVE_redraw_get_stats(EVE_redraw_stats *stats)
+{
+	*stats = redraw_stats;
+}
+
+#endif /* EVE_NO_BURST */
@@ -0,0 +1,98 @@
+/*
+@file    EVE_redraw.h
+@brief   builds and sends a new frame only when something changed
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+The examples build and send a new display-list every 20ms, even when the screen shows the same thing for minutes.
+EVE_redraw_begin() decides if a frame is needed at all, the reasons are:
+- flags set with EVE_redraw_set_dirty() since the last frame
+- a change of the data bound with EVE_redraw_bind(), detected with a hash
+- a change of REG_TOUCH_TAG or REG_TRACKER, selected with EVE_redraw_set_inputs()
+
+if(EVE_redraw_begin())
+{
+	dirty = EVE_redraw_get_dirty(); <- the reasons for this frame
+	EVE_cmd_dl_burst(CMD_DLSTART);
+	...
+	EVE_cmd_dl_burst(DL_DISPLAY);
+	EVE_cmd_dl_burst(CMD_SWAP);
+	EVE_redraw_end();
+}
+
+EVE_redraw_begin() starts the cmd-burst when it returns 1 and EVE_redraw_end() ends it.
+With DMA EVE_redraw_end() also hashes the frame in EVE_dma_buffer and does not send it, CMD_SWAP included,
+when it is the same as the frame that was sent last, for example when a touch only changed the tag
+to one that is not shown differently.
+Without DMA the frame is already sent while it is built, only the check in EVE_redraw_begin() is done then.
+EVE_redraw_begin() returns 0 while a DMA transfer is going on and keeps the reasons for the next call.
+EVE_redraw_set_dirty(EVE_REDRAW_ALL) forces the next frame to be sent, after EVE_init() or when changing pages.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_REDRAW_H_
+#define EVE_REDRAW_H_
+
+#include "EVE_commands.h"
+
+#if !defined (EVE_NO_BURST)
+
+/* max. number of data bindings */
+#if !defined (EVE_REDRAW_BINDINGS)
+#define EVE_REDRAW_BINDINGS 8U
+#endif
+
+/* reasons for a frame, bits 0 to 28 are free for use by the application */
+#define EVE_REDRAW_TOUCH   0x80000000UL /* REG_TOUCH_TAG changed */
+#define EVE_REDRAW_TRACKER 0x40000000UL /* REG_TRACKER changed */
+#define EVE_REDRAW_DATA    0x20000000UL /* the data of a binding changed */
+#define EVE_REDRAW_ALL     0xffffffffUL
+
+typedef struct
+{
+	uint32_t checks;    /* calls of EVE_redraw_begin() */
+	uint32_t frames;    /* frames that were built */
+	uint32_t sent;      /* frames that were sent */
+	uint32_t unchanged; /* checks that found no reason for a frame */
+	uint32_t identical; /* frames that were built but not sent as they are the same as the last one */
+} EVE_redraw_stats;
+
+void EVE_redraw_set_dirty(uint32_t flags);
+void EVE_redraw_set_inputs(uint32_t inputs);
+uint8_t EVE_redraw_bind(const void *data, uint16_t size);
+uint8_t EVE_redraw_begin(void);
+void EVE_redraw_end(void);
+uint32_t EVE_redraw_get_dirty(void);
+void EVE_redraw_get_stats(EVE_redraw_stats *stats);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_REDRAW_H_ */
@@ -0,0 +1,182 @@
+/*
+@file    EVE_region.c
+@brief   incremental frame composition, only the regions of a frame that changed are built again
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_region.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_region.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+typedef struct
+{
+	const char *name;
+	EVE_region_function build;
+	void *context;
+	const uint8_t *data;
+	uint32_t hash;
+	uint16_t size;
+	uint8_t segment; /* EVE_SEGMENT_NONE as long as the region was never captured */
+	uint8_t stable;  /* frames without a change */
+	uint8_t cached;  /* the segment matches the current data */
+} eve_region;
+
+static eve_region regions[EVE_REGION_MAX];
+static uint8_t region_count;
+static EVE_region_stats region_stats;
+
+
+/* returns the id of the new region or EVE_REGION_NONE, the regions are composed in the order they are added */
+/* data can be NULL, the region is only built again after EVE_region_invalidate() then */
+uint8_t EVE_region_add(const char *name, EVE_region_function build, void *context, const void *data, uint16_t size)
+{
+	eve_region *region;
+
+	if(region_count >= EVE_REGION_MAX)
+	{
+		return EVE_REGION_NONE;
+	}
+
+	region = &regions[region_count];
+	region->name = name;
+	region->build = build;
+	region->context = context;
+	region->data = (const uint8_t *) data;
+	region->size = (data != NULL) ? size : 0;
+	region->hash = eve_fnv1a(EVE_FNV1A_INIT, region->data, region->size);
+	region->segment = EVE_SEGMENT_NONE;
+	region->stable = 0;
+	region->cached = 0;
+	return region_count++;
+}
+
+
+void EVE_region_invalidate(uint8_t id)
+{
+	if(id < region_count)
+	{
+		regions[id].stable = 0;
+		regions[id].cached = 0;
+	}
+}
+
+
+/* check the regions for changes and capture the ones that did not change for EVE_REGION_SETTLE frames */
+/* this is to be called outside of display-list building as capturing uses the co-processor */
+void EVE_region_prepare(void)
+{
+	eve_region *region;
+	uint32_t hash;
+	uint8_t id;
+
+	region_stats.captured = 0;
+
+	for(id = 0; id < region_count; id++)
+	{
+		region = &regions[id];
+
+		if(region->size != 0)
+		{
+			hash = eve_fnv1a(EVE_FNV1A_INIT, region->data, region->size);
+			if(hash != region->hash)
+			{
+				region->hash = hash;
+				region->stable = 0;
+				region->cached = 0;
+				continue;
+			}
+		}
+
+		if(!region->cached)
+		{
+			if(region->stable < EVE_REGION_SETTLE)
+			{
+				region->stable++;
+			}
+			else if(region->stable == EVE_REGION_SETTLE)
+			{
+				region->segment = EVE_SEGMENT_NONE;
+				if(EVE_segment_begin_burst(region->name) != EVE_SEGMENT_NONE) /* no cmd-burst was started when all names are in use */
+				{
+					region->build(region->context);
+					region->segment = EVE_segment_end();
+				}
+
+				if(region->segment != EVE_SEGMENT_NONE)
+				{
+					region->cached = 42;
+					region_stats.captured++;
+				}
+				else
+				{
+					region->stable = 0xff; /* no room, do not try again before the region changes */
+				}
+			}
+		}
+	}
+}
+
+
+/* add the regions to the display-list that is currently built */
+void EVE_region_compose_burst(void)
+{
+	eve_region *region;
+	uint8_t id;
+
+	region_stats.appended = 0;
+	region_stats.built = 0;
+
+	for(id = 0; id < region_count; id++)
+	{
+		region = &regions[id];
+		if(region->cached)
+		{
+			EVE_segment_append_burst(&region->segment, 1);
+			region_stats.appended++;
+		}
+		else
+		{
+			region->build(region->context);
+			region_stats.built++;
+		}
+	}
+}
+
+
+void EVE_region_get_stats(EVE_region_stats *stats)
+{
+	*stats = region_stats;
+}
+
+#endif /* EVE_NO_BURST */
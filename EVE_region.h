@@ -0,0 +1,99 @@
+/*
+@file    EVE_region.h
+@brief   incremental frame composition, only the regions of a frame that changed are built again
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+A frame is split into regions, each with a function that builds it with the EVE_cmd_xxx_burst() functions
+and optionally with the data it shows.
+Regions that did not change for EVE_REGION_SETTLE frames are captured into a RAM_G segment with EVE_segment.c,
+from then on they only cost a CMD_APPEND per frame until their data changes again.
+Regions that change are built into the frame directly so a value that changes every frame does not pay for the capture.
+
+speed_region = EVE_region_add("speed", draw_speed, NULL, &speed, sizeof(speed));
+temps_region = EVE_region_add("temps", draw_temps, NULL, temps, sizeof(temps));
+
+and for every frame:
+
+EVE_region_prepare(); <- outside of the cmd-burst, this checks the data and captures the regions that settled
+EVE_start_cmd_burst();
+EVE_cmd_dl_burst(CMD_DLSTART);
+...
+EVE_region_compose_burst(); <- a CMD_APPEND for every captured region, the others are built in place
+...
+EVE_cmd_dl_burst(DL_DISPLAY);
+EVE_cmd_dl_burst(CMD_SWAP);
+EVE_end_cmd_burst();
+
+Changes of the data are detected with a hash over the bound data, EVE_region_invalidate() marks a region as changed
+for everything else.
+A region is the same whether it is appended or built in place, as long as it does not depend on the co-processor state
+like EVE_cmd_fgcolor() that is set outside of it at the time it is captured.
+Every region uses a segment, EVE_SEGMENT_MAX has to be large enough and EVE_segment_init() has to be called first.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_REGION_H_
+#define EVE_REGION_H_
+
+#include "EVE_segment.h"
+
+#if !defined (EVE_NO_BURST)
+
+#if !defined (EVE_REGION_MAX)
+#define EVE_REGION_MAX 16U
+#endif
+
+/* number of frames the data of a region has to stay the same before it is captured */
+#if !defined (EVE_REGION_SETTLE)
+#define EVE_REGION_SETTLE 2U
+#endif
+
+#define EVE_REGION_NONE 0xffU
+
+typedef void (*EVE_region_function)(void *context);
+
+typedef struct
+{
+	uint8_t appended; /* regions added as CMD_APPEND by the last EVE_region_compose_burst() */
+	uint8_t built;    /* regions built in place by the last EVE_region_compose_burst() */
+	uint8_t captured; /* regions captured by the last EVE_region_prepare() */
+} EVE_region_stats;
+
+uint8_t EVE_region_add(const char *name, EVE_region_function build, void *context, const void *data, uint16_t size);
+void EVE_region_invalidate(uint8_t id);
+void EVE_region_prepare(void);
+void EVE_region_compose_burst(void);
+void EVE_region_get_stats(EVE_region_stats *stats);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_REGION_H_ */
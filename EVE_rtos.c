@@ -0,0 +1,772 @@
+/*
+@file    EVE_rtos.c
+@brief   thread-safe access to EVE from several tasks thru a display owner task
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_rtos.h for how to use this.
+
+The submit queue is a bounded multi-producer / single-consumer ring with a sequence counter per slot,
+producers claim a slot with a compare-and-swap on the head, the owner task is the only consumer.
+Posting never takes a lock, a full queue is reported back to the caller instead of blocking.
+This needs the __atomic builtins of GCC or clang which both ESP-IDF and Linux toolchains provide.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- added EVE_RTOS_PIPELINE, frames are built by the calling task and only transmitted by the owner task
+- the owner task uses a buffer of its own with EVE_RTOS_PIPELINE and EVE_rtos_frame_end() restores EVE_dma_buffer of the building task
+
+*/
+
+#if !defined (_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* clock_gettime() for EVE_RTOS_PTHREAD with -std=c99 */
+#endif
+
+#include "EVE_rtos.h"
+#include "EVE_commands_private.h"
+
+#if defined (EVE_RTOS)
+
+#if !defined (__GNUC__)
+#error "EVE_rtos.c needs the __atomic builtins from GCC or clang"
+#endif
+
+#define EVE_RTOS_FOREVER 0xffffffffUL
+
+#define eve_atomic_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define eve_atomic_load_relaxed(ptr) __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define eve_atomic_store(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define eve_atomic_cas(ptr, expected, desired) __atomic_compare_exchange_n((ptr), (expected), (desired), 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- port: FreeRTOS on ESP32 -----------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined (ESP_PLATFORM)
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static void eve_owner_task(void *parameter);
+
+static TaskHandle_t owner = NULL;
+
+static void *port_self(void)
+{
+	return (void *) xTaskGetCurrentTaskHandle();
+}
+
+static void port_notify(void *waiter)
+{
+	xTaskNotifyGive((TaskHandle_t) waiter);
+}
+
+static void port_wait(uint32_t ms)
+{
+	TickType_t ticks = portMAX_DELAY;
+
+	if(ms != EVE_RTOS_FOREVER)
+	{
+		ticks = pdMS_TO_TICKS(ms);
+		if(ticks == 0)
+		{
+			ticks = 1;
+		}
+	}
+	ulTaskNotifyTake(pdTRUE, ticks);
+}
+
+static uint32_t port_millis(void)
+{
+	return (uint32_t) (xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+void EVE_rtos_notify_from_isr(void)
+{
+	BaseType_t woken = pdFALSE;
+
+	if(owner != NULL)
+	{
+		vTaskNotifyGiveFromISR(owner, &woken);
+		if(woken == pdTRUE)
+		{
+			portYIELD_FROM_ISR();
+		}
+	}
+}
+
+#if defined (EVE_INT)
+#include "driver/gpio.h"
+
+static void IRAM_ATTR eve_int_isr(void *arg)
+{
+	EVE_rtos_notify_from_isr();
+}
+
+/* the INT pin of EVE signals that the command-fifo is empty, the owner task sleeps until then */
+static void port_init_int(void)
+{
+	gpio_config_t io_cfg = {0};
+
+	io_cfg.intr_type = GPIO_PIN_INTR_NEGEDGE;
+	io_cfg.mode = GPIO_MODE_INPUT;
+	io_cfg.pin_bit_mask = BIT64(EVE_INT);
+	io_cfg.pull_up_en = 1; /* INT is open-drain by default */
+	gpio_config(&io_cfg);
+
+	gpio_install_isr_service(0);
+	gpio_isr_handler_add(EVE_INT, eve_int_isr, NULL);
+
+	EVE_memWrite8(REG_INT_MASK, EVE_INT_CMDEMPTY);
+	EVE_memWrite8(REG_INT_EN, 1);
+}
+#endif
+
+static uint8_t port_start(void)
+{
+	BaseType_t result;
+
+	result = xTaskCreatePinnedToCore(eve_owner_task, "EVE", EVE_RTOS_TASK_STACK, NULL, EVE_RTOS_TASK_PRIORITY, &owner, EVE_RTOS_TASK_CORE);
+	return (result == pdPASS) ? 1 : 0;
+}
+
+#define EVE_RTOS_TASK_RETURN
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- port: POSIX threads ---------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+#elif defined (EVE_RTOS_PTHREAD)
+
+#include <pthread.h>
+#include <time.h>
+
+static void *eve_owner_task(void *parameter);
+
+typedef struct
+{
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	uint32_t count;
+	uint8_t ready;
+} port_event;
+
+static __thread port_event thread_event; /* one event per thread, the equivalent of a FreeRTOS task notification */
+static void *owner = NULL;
+static pthread_t owner_thread;
+
+static void *port_self(void)
+{
+	if(!thread_event.ready)
+	{
+		pthread_mutex_init(&thread_event.mutex, NULL);
+		pthread_cond_init(&thread_event.cond, NULL);
+		thread_event.count = 0;
+		thread_event.ready = 1;
+	}
+	return &thread_event;
+}
+
+static void port_notify(void *waiter)
+{
+	port_event *event = (port_event *) waiter;
+
+	pthread_mutex_lock(&event->mutex);
+	event->count++;
+	pthread_cond_signal(&event->cond);
+	pthread_mutex_unlock(&event->mutex);
+}
+
+static void port_wait(uint32_t ms)
+{
+	port_event *event = (port_event *) port_self();
+
+	pthread_mutex_lock(&event->mutex);
+	if(event->count == 0)
+	{
+		if(ms == EVE_RTOS_FOREVER)
+		{
+			pthread_cond_wait(&event->cond, &event->mutex);
+		}
+		else
+		{
+			struct timespec until;
+
+			clock_gettime(CLOCK_REALTIME, &until);
+			until.tv_sec += ms / 1000U;
+			until.tv_nsec += (long) (ms % 1000U) * 1000000L;
+			if(until.tv_nsec >= 1000000000L)
+			{
+				until.tv_sec++;
+				until.tv_nsec -= 1000000000L;
+			}
+			pthread_cond_timedwait(&event->cond, &event->mutex, &until);
+		}
+	}
+	event->count = 0;
+	pthread_mutex_unlock(&event->mutex);
+}
+
+static uint32_t port_millis(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t) ((now.tv_sec * 1000UL) + (now.tv_nsec / 1000000L));
+}
+
+void EVE_rtos_notify_from_isr(void)
+{
+	void *target = eve_atomic_load(&owner);
+
+	if(target != NULL)
+	{
+		port_notify(target);
+	}
+}
+
+static uint8_t port_start(void)
+{
+	void *self = port_self();
+
+	if(pthread_create(&owner_thread, NULL, eve_owner_task, self) != 0)
+	{
+		return 0;
+	}
+
+	while(eve_atomic_load(&owner) == NULL) /* the owner thread has to register itself before anything can be posted */
+	{
+		port_wait(EVE_RTOS_POLL_MS);
+	}
+	return 1;
+}
+
+#define EVE_RTOS_TASK_RETURN return NULL
+
+#else
+#error "EVE_RTOS is only supported for ESP_PLATFORM and EVE_RTOS_PTHREAD"
+#endif
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- submit queue ----------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+	uint32_t sequence;
+	EVE_rtos_job job;
+	volatile uint8_t *done;
+} queue_cell;
+
+static queue_cell queue[EVE_RTOS_QUEUE_SIZE];
+static uint32_t queue_head; /* next slot to be claimed by a producer */
+static uint32_t queue_tail; /* next slot to be read by the owner task, only the owner task touches this */
+
+static EVE_rtos_function idle_function;
+static void *idle_context;
+static uint16_t idle_period;
+
+
+static void queue_init(void)
+{
+	uint32_t index;
+
+	for(index = 0; index < EVE_RTOS_QUEUE_SIZE; index++)
+	{
+		queue[index].sequence = index;
+	}
+	queue_head = 0;
+	queue_tail = 0;
+}
+
+
+/* claim a slot, returns NULL when the queue is full */
+static queue_cell *queue_claim(uint32_t *position)
+{
+	queue_cell *cell;
+	uint32_t pos;
+	int32_t diff;
+
+	pos = eve_atomic_load_relaxed(&queue_head);
+	for(;;)
+	{
+		cell = &queue[pos & (EVE_RTOS_QUEUE_SIZE - 1U)];
+		diff = (int32_t) (eve_atomic_load(&cell->sequence) - pos);
+
+		if(diff == 0)
+		{
+			if(eve_atomic_cas(&queue_head, &pos, pos + 1U)) /* on failure pos is updated to the current head */
+			{
+				*position = pos;
+				return cell;
+			}
+		}
+		else if(diff < 0)
+		{
+			return NULL; /* the owner task has not read this slot yet, the queue is full */
+		}
+		else
+		{
+			pos = eve_atomic_load_relaxed(&queue_head); /* another producer was faster */
+		}
+	}
+}
+
+
+static uint8_t queue_pop(EVE_rtos_job *job, volatile uint8_t **done)
+{
+	queue_cell *cell;
+
+	cell = &queue[queue_tail & (EVE_RTOS_QUEUE_SIZE - 1U)];
+	if(eve_atomic_load(&cell->sequence) != (queue_tail + 1U))
+	{
+		return 0;
+	}
+
+	*job = cell->job;
+	*done = cell->done;
+	eve_atomic_store(&cell->sequence, queue_tail + EVE_RTOS_QUEUE_SIZE); /* hand the slot back to the producers */
+	queue_tail++;
+	return 1;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- frame pipeline --------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined (EVE_RTOS_PIPELINE)
+
+/*
+The frame ring is a single-producer / single-consumer queue, frame_head is only written by the building task,
+frame_tail is only written by the owner task.
+A frame buffer is released after its DMA transfer is done so the building task never writes into a buffer that is still sent.
+*/
+
+static uint32_t frame_memory[EVE_RTOS_FRAMES][EVE_RTOS_FRAME_WORDS];
+static uint16_t frame_length[EVE_RTOS_FRAMES];
+static uint32_t frame_head; /* frames published by the building task */
+static uint32_t *frame_saved; /* EVE_dma_buffer of the building task outside of EVE_rtos_frame_begin() / EVE_rtos_frame_end() */
+static uint32_t frame_tail; /* frames released by the owner task */
+static void *frame_waiter; /* the building task while it waits for a free buffer */
+static uint8_t frame_policy = EVE_RTOS_BLOCK;
+static EVE_rtos_frame_stats frame_stats;
+
+static void frame_count(uint32_t *counter, uint32_t amount)
+{
+	__atomic_fetch_add(counter, amount, __ATOMIC_RELAXED);
+}
+
+
+static void frame_release(uint32_t tail)
+{
+	void *waiter;
+
+	eve_atomic_store(&frame_tail, tail);
+	waiter = __atomic_exchange_n(&frame_waiter, NULL, __ATOMIC_ACQ_REL);
+	if(waiter != NULL)
+	{
+		port_notify(waiter);
+	}
+}
+
+
+/* owner task: send the next frame that is ready, returns 0 if there is none */
+static uint8_t frame_send(void)
+{
+	uint32_t tail = eve_atomic_load_relaxed(&frame_tail);
+	uint32_t ready = eve_atomic_load(&frame_head) - tail;
+	uint32_t slot;
+
+	if(ready == 0)
+	{
+		return 0;
+	}
+
+	if((frame_policy == EVE_RTOS_DROP_OLDEST) && (ready > 1U)) /* only the newest frame is of interest */
+	{
+		frame_count(&frame_stats.dropped, ready - 1U);
+		tail += ready - 1U;
+		frame_release(tail);
+	}
+
+	slot = tail & (EVE_RTOS_FRAMES - 1U);
+
+	EVE_rtos_wait_busy(); /* the command-fifo has to be empty for a frame of up to 4k */
+	EVE_start_dma_transfer_buffer(frame_memory[slot], frame_length[slot]);
+	EVE_rtos_wait_dma();
+
+	frame_count(&frame_stats.sent, 1U);
+	frame_release(tail + 1U);
+	return 1;
+}
+
+
+/* start a new frame in the ring, returns 0 if the frame is to be skipped */
+uint8_t EVE_rtos_frame_begin(void)
+{
+	uint32_t head = eve_atomic_load_relaxed(&frame_head);
+	uint32_t ftAddress = REG_CMDB_WRITE;
+	uint8_t stalled = 0;
+
+	while((head - eve_atomic_load(&frame_tail)) >= EVE_RTOS_FRAMES)
+	{
+		if(frame_policy == EVE_RTOS_DROP_NEWEST)
+		{
+			frame_count(&frame_stats.dropped, 1U);
+			return 0;
+		}
+
+		if(!stalled)
+		{
+			stalled = 42;
+			frame_count(&frame_stats.stalled, 1U);
+		}
+
+		eve_atomic_store(&frame_waiter, port_self());
+		if((head - eve_atomic_load(&frame_tail)) >= EVE_RTOS_FRAMES) /* the owner task could have been faster */
+		{
+			port_wait(EVE_RTOS_POLL_MS);
+		}
+	}
+
+	frame_saved = EVE_dma_buffer;
+	EVE_dma_buffer = frame_memory[head & (EVE_RTOS_FRAMES - 1U)];
+	/* 0x low mid hi 00 */
+	EVE_dma_buffer[0] = ((uint8_t)(ftAddress >> 16) | MEM_WRITE) | (ftAddress & 0x0000ff00) |  ((uint8_t)(ftAddress) << 16);
+	EVE_dma_buffer[0] = EVE_dma_buffer[0] << 8;
+	EVE_dma_buffer_index = 1;
+	return 1;
+}
+
+
+/* hand the frame over to the owner task */
+void EVE_rtos_frame_end(void)
+{
+	uint32_t head = eve_atomic_load_relaxed(&frame_head);
+
+	frame_length[head & (EVE_RTOS_FRAMES - 1U)] = EVE_dma_buffer_index;
+	EVE_dma_buffer = frame_saved; /* the slot belongs to the owner task now */
+	eve_atomic_store(&frame_head, head + 1U);
+	frame_count(&frame_stats.built, 1U);
+	port_notify(eve_atomic_load(&owner));
+}
+
+
+void EVE_rtos_set_frame_policy(uint8_t policy)
+{
+	frame_policy = policy;
+}
+
+
+void EVE_rtos_get_frame_stats(EVE_rtos_frame_stats *stats)
+{
+	stats->built = eve_atomic_load_relaxed(&frame_stats.built);
+	stats->sent = eve_atomic_load_relaxed(&frame_stats.sent);
+	stats->dropped = eve_atomic_load_relaxed(&frame_stats.dropped);
+	stats->stalled = eve_atomic_load_relaxed(&frame_stats.stalled);
+}
+
+#endif /* EVE_RTOS_PIPELINE */
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- display owner task ----------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+/* sleep until a running DMA transfer is finished, the end-of-DMA interrupt wakes up the owner task */
+void EVE_rtos_wait_dma(void)
+{
+#if defined (EVE_DMA)
+	while(EVE_dma_busy)
+	{
+		port_wait(EVE_RTOS_POLL_MS);
+	}
+#endif
+}
+
+
+/* sleep until the co-processor is done with the command-fifo, this replaces while(EVE_busy()); for the owner task */
+void EVE_rtos_wait_busy(void)
+{
+	EVE_rtos_wait_dma();
+
+	while(EVE_busy())
+	{
+#if defined (EVE_INT)
+		EVE_memRead8(REG_INT_FLAGS); /* reading clears the flags, INT goes active again with the next CMDEMPTY */
+		if(!EVE_busy())
+		{
+			break;
+		}
+#endif
+		port_wait(EVE_RTOS_POLL_MS);
+	}
+}
+
+
+static void job_execute(const EVE_rtos_job *job)
+{
+	if(job->type == EVE_RTOS_FRAME)
+	{
+		EVE_rtos_wait_busy();
+		EVE_start_cmd_burst();
+		job->function(job->context);
+		EVE_end_cmd_burst();
+		return;
+	}
+
+	EVE_rtos_wait_dma(); /* EVE_memWrite... must not run into the DMA transfer of the last frame */
+
+	switch(job->type)
+	{
+		case EVE_RTOS_CALL:
+			job->function(job->context);
+			break;
+		case EVE_RTOS_WRITE8:
+			EVE_memWrite8(job->address, (uint8_t) job->value);
+			break;
+		case EVE_RTOS_WRITE16:
+			EVE_memWrite16(job->address, (uint16_t) job->value);
+			break;
+		case EVE_RTOS_WRITE32:
+			EVE_memWrite32(job->address, job->value);
+			break;
+		case EVE_RTOS_UPLOAD:
+			EVE_memWrite_sram_buffer(job->address, job->data, job->value);
+			break;
+		default:
+			break;
+	}
+}
+
+
+#if defined (ESP_PLATFORM)
+static void eve_owner_task(void *parameter)
+#else
+static void *eve_owner_task(void *parameter)
+#endif
+{
+	EVE_rtos_job job;
+	volatile uint8_t *done;
+	uint32_t last_idle;
+	uint32_t timeout;
+#if defined (EVE_RTOS_PIPELINE)
+	static uint32_t owner_memory[1025];
+
+	EVE_dma_buffer = owner_memory; /* task-local, bursts from jobs and from the idle function never touch the frame ring */
+#endif
+
+#if defined (EVE_RTOS_PTHREAD)
+	eve_atomic_store(&owner, port_self());
+	port_notify(parameter); /* let EVE_rtos_start() return */
+#endif
+
+#if defined (EVE_INT)
+	port_init_int();
+#endif
+
+	last_idle = port_millis();
+
+	for(;;)
+	{
+		while(queue_pop(&job, &done))
+		{
+			job_execute(&job);
+			if(done != NULL)
+			{
+				eve_atomic_store(done, 1);
+				port_notify(job.waiter);
+			}
+		}
+
+#if defined (EVE_RTOS_PIPELINE)
+		if(frame_send())
+		{
+			continue; /* check for jobs between two frames */
+		}
+#endif
+
+		timeout = EVE_RTOS_FOREVER;
+		if(idle_function != NULL)
+		{
+			uint32_t elapsed = port_millis() - last_idle;
+
+			if(elapsed >= idle_period)
+			{
+				EVE_rtos_wait_dma();
+				idle_function(idle_context);
+				last_idle = port_millis();
+				elapsed = 0;
+			}
+			timeout = idle_period - elapsed;
+		}
+
+		port_wait(timeout); /* posting a job wakes the owner task up early */
+	}
+
+	EVE_RTOS_TASK_RETURN;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------------------------*/
+/*---- public functions ------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------------*/
+
+/* creates the display owner task, EVE_init() has to be done before, from then on only the owner task talks to EVE */
+/* returns 1 on success */
+uint8_t EVE_rtos_start(void)
+{
+	queue_init();
+	return port_start();
+}
+
+
+/* queue a job for the owner task, returns 0 if the queue is full */
+/* with "wait" set the calling task is blocked until the owner task has executed the job */
+uint8_t EVE_rtos_post(const EVE_rtos_job *job, uint8_t wait)
+{
+	volatile uint8_t done = 0;
+	queue_cell *cell;
+	uint32_t position;
+
+	if(port_self() == eve_atomic_load(&owner)) /* posting from a job function, just do it now */
+	{
+		job_execute(job);
+		return 1;
+	}
+
+	cell = queue_claim(&position);
+	if(cell == NULL)
+	{
+		return 0;
+	}
+
+	cell->job = *job;
+	cell->job.waiter = wait ? port_self() : NULL;
+	cell->done = wait ? &done : NULL;
+	eve_atomic_store(&cell->sequence, position + 1U); /* publish the slot to the owner task */
+
+	port_notify(eve_atomic_load(&owner));
+
+	if(wait)
+	{
+		while(!eve_atomic_load(&done)) /* the notification could be for something else in the same task */
+		{
+			port_wait(EVE_RTOS_FOREVER);
+		}
+	}
+	return 1;
+}
+
+
+uint8_t EVE_rtos_post_frame(EVE_rtos_function build, void *context)
+{
+#if defined (EVE_RTOS_PIPELINE)
+	(void) build;
+	(void) context;
+	return 0; /* the frames come from EVE_rtos_frame_begin() / EVE_rtos_frame_end() only */
+#else
+	EVE_rtos_job job = {0};
+
+	job.type = EVE_RTOS_FRAME;
+	job.function = build;
+	job.context = context;
+	return EVE_rtos_post(&job, 0);
+#endif
+}
+
+
+uint8_t EVE_rtos_post_call(EVE_rtos_function function, void *context, uint8_t wait)
+{
+	EVE_rtos_job job = {0};
+
+	job.type = EVE_RTOS_CALL;
+	job.function = function;
+	job.context = context;
+	return EVE_rtos_post(&job, wait);
+}
+
+
+uint8_t EVE_rtos_post_write8(uint32_t address, uint8_t value)
+{
+	EVE_rtos_job job = {0};
+
+	job.type = EVE_RTOS_WRITE8;
+	job.address = address;
+	job.value = value;
+	return EVE_rtos_post(&job, 0);
+}
+
+
+uint8_t EVE_rtos_post_write16(uint32_t address, uint16_t value)
+{
+	EVE_rtos_job job = {0};
+
+	job.type = EVE_RTOS_WRITE16;
+	job.address = address;
+	job.value = value;
+	return EVE_rtos_post(&job, 0);
+}
+
+
+uint8_t EVE_rtos_post_write32(uint32_t address, uint32_t value)
+{
+	EVE_rtos_job job = {0};
+
+	job.type = EVE_RTOS_WRITE32;
+	job.address = address;
+	job.value = value;
+	return EVE_rtos_post(&job, 0);
+}
+
+
+/* without "wait" the data has to stay valid until the owner task is done with it */
+uint8_t EVE_rtos_post_upload(uint32_t address, const uint8_t *data, uint32_t length, uint8_t wait)
+{
+	EVE_rtos_job job = {0};
+
+	job.type = EVE_RTOS_UPLOAD;
+	job.address = address;
+	job.data = data;
+	job.value = length;
+	return EVE_rtos_post(&job, wait);
+}
+
+
+/* the idle function is called by the owner task every "period_ms" while there is nothing else to do, for example to read touch */
+/* this is to be called before EVE_rtos_start() */
+void EVE_rtos_set_idle(EVE_rtos_function function, void *context, uint16_t period_ms)
+{
+	idle_context = context;
+	idle_period = period_ms;
+	idle_function = function;
+}
+
+#endif /* EVE_RTOS */
@@ -0,0 +1,208 @@
+/*
+@file    EVE_rtos.h
+@brief   thread-safe access to EVE from several tasks thru a display owner task
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+The functions in EVE_commands.c are not thread-safe, cmd_burst, EVE_dma_buffer_index and the command-fifo itself
+are shared state without any protection.
+With this layer only one task, the display owner task, ever touches EVE.
+Other tasks post jobs into a lock-free queue: frames, register writes, uploads and generic calls.
+The owner task executes these in order and blocks on notifications while it waits for the DMA or the co-processor
+instead of spinning on EVE_busy().
+
+Ports:
+- ESP_PLATFORM: FreeRTOS, the owner task is pinned to EVE_RTOS_TASK_CORE
+- EVE_RTOS_PTHREAD: POSIX threads, for Linux hosts and for testing on a PC
+
+Usage:
+- EVE_init_spi() and EVE_init() from one task as usual
+- EVE_rtos_start()
+- from then on only post jobs, a frame job is a function that uses the EVE_cmd_xxx_burst() functions:
+
+void my_frame(void *context)
+{
+	EVE_cmd_dl_burst(CMD_DLSTART);
+	...
+	EVE_cmd_dl_burst(DL_DISPLAY);
+	EVE_cmd_dl_burst(CMD_SWAP);
+}
+
+EVE_rtos_post_frame(my_frame, &my_data);
+
+The owner task calls EVE_start_cmd_burst() / EVE_end_cmd_burst() around the frame function.
+Jobs that are posted with "wait" set block the posting task until the owner task has executed them.
+The FreeRTOS port uses the task-notification of the posting task for this.
+
+Frame pipeline, EVE_RTOS_PIPELINE:
+The frame is built by the calling task into a ring of EVE_RTOS_FRAMES frame buffers and the owner task only transmits it.
+With the owner task pinned to the other core of the ESP32 building the next frame overlaps with sending the last one
+and with waiting for the co-processor to execute it.
+
+if(EVE_rtos_frame_begin())
+{
+	EVE_cmd_dl_burst(CMD_DLSTART);
+	...
+	EVE_cmd_dl_burst(CMD_SWAP);
+	EVE_rtos_frame_end();
+}
+
+Only one task may build frames and only the EVE_cmd_xxx_burst() functions can be used for this.
+EVE_rtos_post_frame() is not available then, the frames come from the ring only.
+EVE_dma_buffer and EVE_dma_buffer_index are task-local with EVE_RTOS_PIPELINE, the building task points its EVE_dma_buffer
+into the ring from EVE_rtos_frame_begin() to EVE_rtos_frame_end() and the owner task has a buffer of its own,
+so EVE_RTOS_CALL jobs and the idle function can use cmd-burst without writing into a frame that is not sent yet.
+The policy decides what happens when frames are built faster than they can be sent:
+- EVE_RTOS_BLOCK: EVE_rtos_frame_begin() waits for a free buffer, backpressure for the building task
+- EVE_RTOS_DROP_NEWEST: EVE_rtos_frame_begin() returns 0 and the frame is skipped
+- EVE_RTOS_DROP_OLDEST: the owner task only sends the newest frame that is ready, EVE_rtos_frame_begin() waits if the ring is full
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- added EVE_RTOS_PIPELINE, frames are built by the calling task and only transmitted by the owner task
+- the owner task uses a buffer of its own with EVE_RTOS_PIPELINE and EVE_rtos_frame_end() restores EVE_dma_buffer of the building task
+
+*/
+
+#pragma once
+
+#ifndef EVE_RTOS_H_
+#define EVE_RTOS_H_
+
+#include "EVE_commands.h"
+
+#if defined (EVE_RTOS)
+
+/* number of jobs that can be queued, needs to be a power of two */
+#if !defined (EVE_RTOS_QUEUE_SIZE)
+#define EVE_RTOS_QUEUE_SIZE 16U
+#endif
+
+/* the owner task re-checks EVE at least this often while it is waiting, in case a notification was missed */
+#if !defined (EVE_RTOS_POLL_MS)
+#define EVE_RTOS_POLL_MS 2U
+#endif
+
+#if !defined (EVE_RTOS_TASK_STACK)
+#define EVE_RTOS_TASK_STACK 4096U
+#endif
+
+#if !defined (EVE_RTOS_TASK_PRIORITY)
+#define EVE_RTOS_TASK_PRIORITY 5U
+#endif
+
+#if !defined (EVE_RTOS_TASK_CORE)
+#define EVE_RTOS_TASK_CORE 1
+#endif
+
+#if (EVE_RTOS_QUEUE_SIZE & (EVE_RTOS_QUEUE_SIZE - 1U)) != 0
+#error "EVE_RTOS_QUEUE_SIZE needs to be a power of two"
+#endif
+
+#if defined (EVE_RTOS_PIPELINE)
+
+#if !defined (EVE_DMA)
+#error "EVE_RTOS_PIPELINE needs EVE_DMA"
+#endif
+
+/* number of frame buffers in the ring, needs to be a power of two */
+#if !defined (EVE_RTOS_FRAMES)
+#define EVE_RTOS_FRAMES 4U
+#endif
+
+/* size of a frame buffer in 32 bit words, the first word is the address just like with EVE_dma_buffer */
+#if !defined (EVE_RTOS_FRAME_WORDS)
+#define EVE_RTOS_FRAME_WORDS 1025U
+#endif
+
+#if (EVE_RTOS_FRAMES & (EVE_RTOS_FRAMES - 1U)) != 0
+#error "EVE_RTOS_FRAMES needs to be a power of two"
+#endif
+
+#define EVE_RTOS_BLOCK       0U
+#define EVE_RTOS_DROP_NEWEST 1U
+#define EVE_RTOS_DROP_OLDEST 2U
+
+typedef struct
+{
+	uint32_t built;   /* frames passed to the owner task */
+	uint32_t sent;    /* frames transmitted to EVE */
+	uint32_t dropped; /* frames skipped by the policy */
+	uint32_t stalled; /* number of times EVE_rtos_frame_begin() had to wait for a free buffer */
+} EVE_rtos_frame_stats;
+
+#endif /* EVE_RTOS_PIPELINE */
+
+typedef void (*EVE_rtos_function)(void *context);
+
+/* types of jobs for the display owner task */
+#define EVE_RTOS_FRAME   1U /* function is called between EVE_start_cmd_burst() and EVE_end_cmd_burst() */
+#define EVE_RTOS_CALL    2U /* function is called as it is, it can use any EVE_xxx() function */
+#define EVE_RTOS_WRITE8  3U /* EVE_memWrite8(address, value) */
+#define EVE_RTOS_WRITE16 4U /* EVE_memWrite16(address, value) */
+#define EVE_RTOS_WRITE32 5U /* EVE_memWrite32(address, value) */
+#define EVE_RTOS_UPLOAD  6U /* EVE_memWrite_sram_buffer(address, data, length) */
+
+typedef struct
+{
+	EVE_rtos_function function;
+	void *context;
+	const uint8_t *data;
+	uint32_t address;
+	uint32_t value; /* the value to write or the length of data */
+	void *waiter; /* set by EVE_rtos_post() for jobs that are waited for */
+	uint8_t type;
+} EVE_rtos_job;
+
+uint8_t EVE_rtos_start(void);
+uint8_t EVE_rtos_post(const EVE_rtos_job *job, uint8_t wait);
+
+uint8_t EVE_rtos_post_frame(EVE_rtos_function build, void *context);
+uint8_t EVE_rtos_post_call(EVE_rtos_function function, void *context, uint8_t wait);
+uint8_t EVE_rtos_post_write8(uint32_t address, uint8_t value);
+uint8_t EVE_rtos_post_write16(uint32_t address, uint16_t value);
+uint8_t EVE_rtos_post_write32(uint32_t address, uint32_t value);
+uint8_t EVE_rtos_post_upload(uint32_t address, const uint8_t *data, uint32_t length, uint8_t wait);
+
+void EVE_rtos_set_idle(EVE_rtos_function function, void *context, uint16_t period_ms);
+
+#if defined (EVE_RTOS_PIPELINE)
+uint8_t EVE_rtos_frame_begin(void);
+void EVE_rtos_frame_end(void);
+void EVE_rtos_set_frame_policy(uint8_t policy);
+void EVE_rtos_get_frame_stats(EVE_rtos_frame_stats *stats);
+#endif
+
+/* these are for use by the owner task only, from within the job functions */
+void EVE_rtos_wait_dma(void);
+void EVE_rtos_wait_busy(void);
+
+/* called by the target code from the end-of-DMA interrupt */
+void EVE_rtos_notify_from_isr(void);
+
+#endif /* EVE_RTOS */
+
+#endif /* EVE_RTOS_H_ */
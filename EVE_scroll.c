@@ -0,0 +1,280 @@
+/*
+@file    EVE_scroll.c
+@brief   scrolling lists that only send the rows that are visible
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_scroll.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_scroll.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+#if defined (EVE_DMA)
+
+typedef struct
+{
+	const EVE_scroll *list;
+	uint32_t words[EVE_SCROLL_ROW_WORDS];
+	uint16_t row;
+	uint16_t count; /* 0 for an empty slot */
+} scroll_row;
+
+static scroll_row row_cache[EVE_SCROLL_CACHE]; /* direct mapped, the visible rows are next to each other */
+
+#endif
+
+
+/* rows * row_height can be up to 65535 * 65535, this does not fit into an int32_t */
+static int32_t scroll_max(const EVE_scroll *list)
+{
+	int64_t max = ((int64_t) list->rows * list->row_height) - list->h;
+
+	if(max > 0x7fffffffL)
+	{
+		max = 0x7fffffffL;
+	}
+	return (max > 0) ? (int32_t) max : 0;
+}
+
+
+void EVE_scroll_init(EVE_scroll *list, EVE_scroll_function draw_row, void *context,
+					int16_t x, int16_t y, int16_t w, int16_t h, uint16_t row_height, uint16_t rows)
+{
+	list->draw_row = draw_row;
+	list->context = context;
+	list->offset = 0;
+	list->x = x;
+	list->y = y;
+	list->w = w;
+	list->h = h;
+	list->touch_y = 0;
+	list->row_height = (row_height != 0) ? row_height : 1U;
+	list->rows = rows;
+	list->tag = 0;
+	list->bar_tag = 0;
+	list->bar_width = 0;
+	list->dragging = 0;
+	EVE_scroll_invalidate(list);
+}
+
+
+/* returns 1 if the position changed */
+uint8_t EVE_scroll_to(EVE_scroll *list, int32_t offset)
+{
+	int32_t max = scroll_max(list);
+
+	if(offset > max)
+	{
+		offset = max;
+	}
+	if(offset < 0)
+	{
+		offset = 0;
+	}
+
+	if(offset != list->offset)
+	{
+		list->offset = offset;
+		return 1;
+	}
+	return 0;
+}
+
+
+/* the rows that already were in the list keep their cached words */
+void EVE_scroll_set_rows(EVE_scroll *list, uint16_t rows)
+{
+	list->rows = rows;
+	(void) EVE_scroll_to(list, list->offset);
+}
+
+
+/* CMD_TRACK for the scrollbar, the tracker reports the position along the bar */
+void EVE_scroll_track(const EVE_scroll *list)
+{
+	if((list->bar_tag != 0) && (list->bar_width != 0))
+	{
+		EVE_cmd_track(list->x + list->w - list->bar_width, list->y, list->bar_width, list->h, list->bar_tag);
+	}
+}
+
+
+/* tag: REG_TOUCH_TAG, tracker: REG_TRACKER, touch_xy: REG_TOUCH_SCREEN_XY, returns 1 if the list scrolled */
+uint8_t EVE_scroll_input(EVE_scroll *list, uint8_t tag, uint32_t tracker, uint32_t touch_xy)
+{
+	int16_t touch_y = (int16_t) (touch_xy & 0xffffUL);
+	uint8_t changed = 0;
+
+	if((tag != 0) && (tag == list->bar_tag) && ((tracker & 0xffUL) == list->bar_tag))
+	{
+		changed = EVE_scroll_to(list, (int32_t) (((uint64_t) (tracker >> 16) * (uint32_t) scroll_max(list)) / 65535UL));
+		list->dragging = 0;
+	}
+	else if((tag != 0) && (tag == list->tag) && ((touch_xy & 0x8000UL) == 0))
+	{
+		if(list->dragging)
+		{
+			changed = EVE_scroll_to(list, list->offset + (list->touch_y - touch_y));
+		}
+		list->touch_y = touch_y;
+		list->dragging = 42;
+	}
+	else
+	{
+		list->dragging = 0;
+	}
+	return changed;
+}
+
+
+void EVE_scroll_invalidate(const EVE_scroll *list)
+{
+#if defined (EVE_DMA)
+	uint8_t slot;
+
+	for(slot = 0; slot < EVE_SCROLL_CACHE; slot++)
+	{
+		if(row_cache[slot].list == list)
+		{
+			row_cache[slot].count = 0;
+		}
+	}
+#else
+	(void) list;
+#endif
+}
+
+
+void EVE_scroll_invalidate_row(const EVE_scroll *list, uint16_t row)
+{
+#if defined (EVE_DMA)
+	scroll_row *slot = &row_cache[row % EVE_SCROLL_CACHE];
+
+	if((slot->list == list) && (slot->row == row))
+	{
+		slot->count = 0;
+	}
+#else
+	(void) list;
+	(void) row;
+#endif
+}
+
+
+static void scroll_draw_row(EVE_scroll *list, uint16_t row)
+{
+#if defined (EVE_DMA)
+	scroll_row *slot = &row_cache[row % EVE_SCROLL_CACHE];
+	uint16_t start;
+	uint16_t count;
+
+	if((slot->count != 0) && (slot->list == list) && (slot->row == row))
+	{
+		private_words_write_burst(slot->words, slot->count);
+		return;
+	}
+
+	start = EVE_dma_buffer_index;
+	list->draw_row(list->context, row);
+	count = EVE_dma_buffer_index - start;
+
+	slot->count = 0;
+	if((count != 0) && (count <= EVE_SCROLL_ROW_WORDS))
+	{
+		uint16_t index;
+
+		for(index = 0; index < count; index++)
+		{
+			slot->words[index] = EVE_dma_buffer[start + index];
+		}
+		slot->list = list;
+		slot->row = row;
+		slot->count = count;
+	}
+#else
+	list->draw_row(list->context, row);
+#endif
+}
+
+
+void EVE_scroll_render_burst(EVE_scroll *list)
+{
+	int32_t top;
+	uint16_t row;
+	int16_t width = list->w;
+
+	if(list->bar_width != 0)
+	{
+		width -= list->bar_width;
+	}
+
+	EVE_cmd_dl_burst(SAVE_CONTEXT());
+	EVE_cmd_dl_burst(SCISSOR_XY(list->x, list->y));
+	EVE_cmd_dl_burst(SCISSOR_SIZE(width, list->h));
+	EVE_cmd_dl_burst(TAG(list->tag));
+
+	row = (uint16_t) (list->offset / list->row_height);
+	top = list->y - (list->offset % list->row_height);
+
+	while((row < list->rows) && (top < (list->y + list->h)))
+	{
+		EVE_cmd_dl_burst(VERTEX_TRANSLATE_Y((uint32_t) (top * 16)));
+		EVE_cmd_dl_burst(VERTEX_TRANSLATE_X((uint32_t) (list->x * 16)));
+		scroll_draw_row(list, row);
+		top += list->row_height;
+		row++;
+	}
+
+	EVE_cmd_dl_burst(VERTEX_TRANSLATE_X(0));
+	EVE_cmd_dl_burst(VERTEX_TRANSLATE_Y(0));
+	EVE_cmd_dl_burst(RESTORE_CONTEXT());
+
+	if(list->bar_width != 0)
+	{
+		uint32_t range = (uint32_t) list->rows * list->row_height;
+		uint32_t size = (uint32_t) list->h;
+		uint32_t value = (uint32_t) list->offset;
+
+		while(range > 65535UL) /* the scrollbar only takes 16 bit values */
+		{
+			range >>= 1;
+			size >>= 1;
+			value >>= 1;
+		}
+
+		EVE_cmd_dl_burst(TAG(list->bar_tag));
+		EVE_cmd_scrollbar_burst(list->x + width, list->y, list->bar_width, list->h, 0, (uint16_t) value, (uint16_t) size, (uint16_t) range);
+	}
+}
+
+#endif /* EVE_NO_BURST */
@@ -0,0 +1,117 @@
+/*
+@file    EVE_scroll.h
+@brief   scrolling lists that only send the rows that are visible
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+A list with hundreds of rows does not fit into RAM_DL, even when scissoring hides most of them.
+EVE_scroll_render_burst() only calls the draw function for the rows that are in the viewport,
+the cost of a frame depends on the height of the viewport and not on the length of the list.
+
+static void draw_lap(void *context, uint16_t row)
+{
+	EVE_cmd_text_burst(10, 4, 27, 0, lap_text[row]); <- x and y are relative to the top left corner of the row
+}
+
+static EVE_scroll laps;
+
+EVE_scroll_init(&laps, draw_lap, NULL, 0, 40, 400, 200, 30, lap_count);
+laps.tag = 20; <- touch-drag on the rows scrolls
+laps.bar_tag = 21; <- the scrollbar is tracked with CMD_TRACK
+laps.bar_width = 12;
+EVE_scroll_track(&laps); <- once, outside of display-list building
+
+and for every frame:
+
+changed = EVE_scroll_input(&laps, EVE_memRead8(REG_TOUCH_TAG), EVE_memRead32(REG_TRACKER), EVE_memRead32(REG_TOUCH_SCREEN_XY));
+...
+EVE_scroll_render_burst(&laps);
+
+Each row is drawn at y = 0 and moved into place with VERTEX_TRANSLATE_Y, the viewport is cut out with SCISSOR_XY / SCISSOR_SIZE.
+The draw function should not use negative y coordinates, like OPT_CENTERY on y = 0.
+With DMA the words of every row that was drawn are kept in a cache of EVE_SCROLL_CACHE rows of up to EVE_SCROLL_ROW_WORDS
+words, as the rows do not depend on the position anymore they are sent from the cache while the list scrolls.
+EVE_scroll_invalidate() / EVE_scroll_invalidate_row() have to be called when the content of rows changes.
+The return value of EVE_scroll_input() can be used with EVE_redraw_set_dirty().
+The offset is an int32_t, lists with more than 2^31 pixels in total can only be scrolled that far.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_SCROLL_H_
+#define EVE_SCROLL_H_
+
+#include "EVE_commands.h"
+
+#if !defined (EVE_NO_BURST)
+
+/* number of rows in the cache, shared by all lists, this should be more than the number of visible rows */
+#if !defined (EVE_SCROLL_CACHE)
+#define EVE_SCROLL_CACHE 32U
+#endif
+
+/* max. number of words for a row in the cache, larger rows are not cached */
+#if !defined (EVE_SCROLL_ROW_WORDS)
+#define EVE_SCROLL_ROW_WORDS 24U
+#endif
+
+typedef void (*EVE_scroll_function)(void *context, uint16_t row);
+
+typedef struct
+{
+	EVE_scroll_function draw_row;
+	void *context;
+	int32_t offset;     /* scroll position in pixels */
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+	int16_t touch_y;    /* the last y coordinate of a touch-drag */
+	uint16_t row_height;
+	uint16_t rows;
+	uint8_t tag;        /* tag for the rows, 0 for no touch-drag */
+	uint8_t bar_tag;    /* tag for the scrollbar, 0 for no tracking */
+	uint8_t bar_width;  /* 0 for no scrollbar */
+	uint8_t dragging;
+} EVE_scroll;
+
+void EVE_scroll_init(EVE_scroll *list, EVE_scroll_function draw_row, void *context,
+					int16_t x, int16_t y, int16_t w, int16_t h, uint16_t row_height, uint16_t rows);
+void EVE_scroll_set_rows(EVE_scroll *list, uint16_t rows);
+uint8_t EVE_scroll_to(EVE_scroll *list, int32_t offset);
+void EVE_scroll_track(const EVE_scroll *list);
+uint8_t EVE_scroll_input(EVE_scroll *list, uint8_t tag, uint32_t tracker, uint32_t touch_xy);
+void EVE_scroll_invalidate(const EVE_scroll *list);
+void EVE_scroll_invalidate_row(const EVE_scroll *list, uint16_t row);
+void EVE_scroll_render_burst(EVE_scroll *list);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_SCROLL_H_ */
@@ -0,0 +1,250 @@
+/*
+@file    EVE_segment.c
+@brief   cache for static parts of display-lists in RAM_G
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_segment.h for how to use this.
+
+The RAM_G area is handed out from the bottom up, a segment that is rebuilt keeps its place as long as it still fits
+or if it is the last one that got space, otherwise it moves to a new place and the old space is lost until EVE_segment_init().
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- added EVE_segment_begin_burst()
+
+*/
+
+#include <string.h>
+
+#include "EVE_segment.h"
+
+static EVE_segment segments[EVE_SEGMENT_MAX];
+static uint8_t segment_count;
+static uint8_t segment_building = EVE_SEGMENT_NONE;
+static uint8_t segment_burst; /* the segment is built with a cmd-burst */
+static uint32_t area_base;
+static uint32_t area_end;
+static uint32_t area_next; /* first free address */
+
+
+/* hand an area of RAM_G to the segment cache, this forgets all segments */
+void EVE_segment_init(uint32_t base, uint32_t size)
+{
+	area_base = (base + 3U) & ~3UL; /* CMD_APPEND needs 4-byte aligned addresses */
+	area_end = base + size;
+	area_next = area_base;
+	segment_count = 0;
+	segment_building = EVE_SEGMENT_NONE;
+}
+
+
+uint8_t EVE_segment_find(const char *name)
+{
+	uint8_t id;
+
+	for(id = 0; id < segment_count; id++)
+	{
+		if(strcmp(segments[id].name, name) == 0)
+		{
+			return id;
+		}
+	}
+	return EVE_SEGMENT_NONE;
+}
+
+
+const EVE_segment *EVE_segment_get(uint8_t id)
+{
+	if(id < segment_count)
+	{
+		return &segments[id];
+	}
+	return NULL;
+}
+
+
+/* find or add the segment and wait for the co-processor to be done with everything before it */
+static uint8_t segment_claim(const char *name)
+{
+	uint8_t id;
+
+	id = EVE_segment_find(name);
+	if(id == EVE_SEGMENT_NONE)
+	{
+		if(segment_count >= EVE_SEGMENT_MAX)
+		{
+			return EVE_SEGMENT_NONE;
+		}
+		id = segment_count;
+		segments[id].name = name;
+		segments[id].address = 0;
+		segments[id].size = 0;
+		segments[id].capacity = 0;
+		segments[id].crc = 0;
+		segment_count++;
+	}
+
+	segment_building = id;
+	while (EVE_busy());
+	return id;
+}
+
+
+/* start building a segment, returns its id or EVE_SEGMENT_NONE if there is no room for another one */
+/* building a segment with a name that already exists replaces the old one */
+uint8_t EVE_segment_begin(const char *name)
+{
+	uint8_t id = segment_claim(name);
+
+	if(id != EVE_SEGMENT_NONE)
+	{
+#if defined (EVE_BURST_ONLY)
+		segment_burst = 42;
+		EVE_start_cmd_burst();
+		EVE_cmd_dl_burst(CMD_DLSTART);
+#else
+		segment_burst = 0;
+		EVE_cmd_dl(CMD_DLSTART);
+#endif
+	}
+	return id;
+}
+
+
+#if !defined (EVE_NO_BURST)
+
+/* same as EVE_segment_begin() but the segment is built with the EVE_cmd_xxx_burst() functions */
+uint8_t EVE_segment_begin_burst(const char *name)
+{
+	uint8_t id = segment_claim(name);
+
+	if(id != EVE_SEGMENT_NONE)
+	{
+		segment_burst = 42;
+		EVE_start_cmd_burst();
+		EVE_cmd_dl_burst(CMD_DLSTART);
+	}
+	return id;
+}
+
+#endif /* EVE_NO_BURST */
+
+
+/* copy what was built since EVE_segment_begin() to RAM_G, returns the id of the segment or EVE_SEGMENT_NONE if there is not enough room */
+uint8_t EVE_segment_end(void)
+{
+	EVE_segment *segment;
+	uint32_t size;
+	uint8_t id = segment_building;
+
+	if(id == EVE_SEGMENT_NONE)
+	{
+		return EVE_SEGMENT_NONE;
+	}
+	segment_building = EVE_SEGMENT_NONE;
+	segment = &segments[id];
+
+	if(segment_burst)
+	{
+		segment_burst = 0;
+		EVE_end_cmd_burst();
+	}
+	while (EVE_busy());
+	size = EVE_memRead16(REG_CMD_DL);
+
+	if(size > segment->capacity)
+	{
+		if((segment->capacity != 0) && ((segment->address + segment->capacity) == area_next)) /* the last one can just grow */
+		{
+			area_next = segment->address;
+		}
+
+		if((area_end - area_next) < size)
+		{
+			segment->size = 0; /* appending it does nothing now */
+			segment->capacity = 0;
+			return EVE_SEGMENT_NONE;
+		}
+		segment->address = area_next;
+		segment->capacity = size;
+		area_next += size;
+	}
+
+	segment->size = size;
+	EVE_cmd_memcpy(segment->address, EVE_RAM_DL, size);
+	while (EVE_busy());
+	segment->crc = EVE_cmd_memcrc(segment->address, size);
+	return id;
+}
+
+
+/* returns 1 if the copy of the segment in RAM_G still has the crc it had when it was built */
+uint8_t EVE_segment_check(uint8_t id)
+{
+	if((id >= segment_count) || (segments[id].size == 0))
+	{
+		return 0;
+	}
+	return (EVE_cmd_memcrc(segments[id].address, segments[id].size) == segments[id].crc) ? 1 : 0;
+}
+
+
+#if !defined (EVE_BURST_ONLY)
+
+/* add CMD_APPEND for every segment in the list to the display-list that is currently built */
+void EVE_segment_append(const uint8_t *ids, uint8_t count)
+{
+	uint8_t index;
+
+	for(index = 0; index < count; index++)
+	{
+		if((ids[index] < segment_count) && (segments[ids[index]].size != 0))
+		{
+			EVE_cmd_append(segments[ids[index]].address, segments[ids[index]].size);
+		}
+	}
+}
+
+#endif /* EVE_BURST_ONLY */
+
+
+#if !defined (EVE_NO_BURST)
+
+void EVE_segment_append_burst(const uint8_t *ids, uint8_t count)
+{
+	uint8_t index;
+
+	for(index = 0; index < count; index++)
+	{
+		if((ids[index] < segment_count) && (segments[ids[index]].size != 0))
+		{
+			EVE_cmd_append_burst(segments[ids[index]].address, segments[ids[index]].size);
+		}
+	}
+}
+
+#endif /* EVE_NO_BURST */
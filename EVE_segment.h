@@ -0,0 +1,100 @@
+/*
+@file    EVE_segment.h
+@brief   cache for static parts of display-lists in RAM_G
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Parts of a display-list that do not change, like the background of a page, can be built once by the co-processor,
+copied from RAM_DL to RAM_G and then be inserted into every frame with CMD_APPEND instead of being sent again.
+This module manages these segments by name in an area of RAM_G that is handed to EVE_segment_init().
+
+EVE_segment_init(EVE_RAM_G_SIZE - 8192, 8192);
+
+EVE_segment_begin("fault_page");
+EVE_cmd_dl(TAG(0));
+EVE_cmd_text(...);
+...
+fault_page = EVE_segment_end();
+
+and in the frame:
+
+const uint8_t page[] = {background, fault_page};
+EVE_segment_append_burst(page, 2);
+
+EVE_segment_begin() / EVE_segment_end() are meant to be used outside of display-list building,
+the commands in between are the EVE_cmd_xxx() functions, with EVE_BURST_ONLY these are the EVE_cmd_xxx_burst() functions.
+EVE_segment_begin_burst() starts a cmd-burst instead so the same function can build a segment and a part of a frame.
+Co-processor commands that only change the state of the co-processor like EVE_cmd_bgcolor() do not end up in the segment.
+The names are not copied, these need to stay valid, string literals are fine.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+- added EVE_segment_begin_burst()
+
+*/
+
+#pragma once
+
+#ifndef EVE_SEGMENT_H_
+#define EVE_SEGMENT_H_
+
+#include "EVE_commands.h"
+
+/* max. number of segments */
+#if !defined (EVE_SEGMENT_MAX)
+#define EVE_SEGMENT_MAX 8U
+#endif
+
+#define EVE_SEGMENT_NONE 0xffU
+
+typedef struct
+{
+	const char *name;
+	uint32_t address;  /* in RAM_G */
+	uint32_t size;     /* in bytes, the value of REG_CMD_DL after building it */
+	uint32_t capacity; /* space reserved in RAM_G, a segment can be rebuilt in place if it does not grow beyond this */
+	uint32_t crc;      /* CMD_MEMCRC over the copy in RAM_G */
+} EVE_segment;
+
+void EVE_segment_init(uint32_t base, uint32_t size);
+uint8_t EVE_segment_begin(const char *name);
+#if !defined (EVE_NO_BURST)
+uint8_t EVE_segment_begin_burst(const char *name);
+#endif
+uint8_t EVE_segment_end(void);
+uint8_t EVE_segment_find(const char *name);
+const EVE_segment *EVE_segment_get(uint8_t id);
+uint8_t EVE_segment_check(uint8_t id);
+
+#if !defined (EVE_BURST_ONLY)
+void EVE_segment_append(const uint8_t *ids, uint8_t count);
+#endif
+
+#if !defined (EVE_NO_BURST)
+void EVE_segment_append_burst(const uint8_t *ids, uint8_t count);
+#endif
+
+#endif /* EVE_SEGMENT_H_ */
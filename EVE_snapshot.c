@@ -0,0 +1,201 @@
+/*
+@file    EVE_snapshot.c
+@brief   render-to-texture cache, expensive content is rendered once into a bitmap in RAM_G with CMD_SNAPSHOT2
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_snapshot.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include "EVE_snapshot.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+typedef struct
+{
+	EVE_snapshot_function draw;
+	void *context;
+	const uint8_t *data;
+	uint32_t hash;
+	uint32_t address;
+	int16_t x;
+	int16_t y;
+	uint16_t w;
+	uint16_t h;
+	uint16_t size;
+	uint8_t format;
+	uint8_t valid; /* the bitmap in RAM_G is up to date */
+} eve_snapshot;
+
+static eve_snapshot snapshots[EVE_SNAPSHOT_MAX];
+static uint8_t snapshot_count;
+static uint32_t snapshot_base;
+static EVE_snapshot_stats snapshot_stats;
+
+
+/* hand an area of RAM_G to the cache, this forgets all snapshots */
+void EVE_snapshot_init(uint32_t base, uint32_t size)
+{
+	snapshot_base = base;
+	snapshot_count = 0;
+	snapshot_stats.used = 0;
+	snapshot_stats.size = size;
+}
+
+
+/* format is EVE_RGB565 or EVE_ARGB4, data can be NULL for a snapshot that only changes with EVE_snapshot_invalidate() */
+uint8_t EVE_snapshot_add(EVE_snapshot_function draw, void *context, const void *data, uint16_t size,
+						int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t format)
+{
+	eve_snapshot *snapshot;
+	uint32_t bytes = ((uint32_t) w * h * 2U + 3U) & ~3UL;
+
+	if((snapshot_count >= EVE_SNAPSHOT_MAX) || (bytes > (snapshot_stats.size - snapshot_stats.used)) ||
+		((format != EVE_RGB565) && (format != EVE_ARGB4)))
+	{
+		return EVE_SNAPSHOT_NONE;
+	}
+
+	snapshot = &snapshots[snapshot_count];
+	snapshot->draw = draw;
+	snapshot->context = context;
+	snapshot->data = (const uint8_t *) data;
+	snapshot->size = (data != 0) ? size : 0;
+	snapshot->hash = eve_fnv1a(EVE_FNV1A_INIT, snapshot->data, snapshot->size);
+	snapshot->address = snapshot_base + snapshot_stats.used;
+	snapshot->x = x;
+	snapshot->y = y;
+	snapshot->w = w;
+	snapshot->h = h;
+	snapshot->format = format;
+	snapshot->valid = 0;
+	snapshot_stats.used += bytes;
+	return snapshot_count++;
+}
+
+
+void EVE_snapshot_invalidate(uint8_t id)
+{
+	if(id < snapshot_count)
+	{
+		snapshots[id].valid = 0;
+	}
+}
+
+
+static void snapshot_render(eve_snapshot *snapshot)
+{
+	EVE_start_cmd_burst();
+	EVE_cmd_dl_burst(CMD_DLSTART);
+	EVE_cmd_dl_burst(CLEAR_COLOR_RGB(0, 0, 0));
+	EVE_cmd_dl_burst(CLEAR_COLOR_A(0));
+	EVE_cmd_dl_burst(CLEAR(1, 1, 1));
+	snapshot->draw(snapshot->context);
+	EVE_cmd_dl_burst(DL_DISPLAY);
+	EVE_cmd_dl_burst(CMD_SWAP);
+	EVE_end_cmd_burst();
+	while(EVE_busy());
+
+	EVE_cmd_snapshot2(snapshot->format, snapshot->address, snapshot->x, snapshot->y, (int16_t) snapshot->w, (int16_t) snapshot->h);
+	snapshot->valid = 42;
+	snapshot_stats.renders++;
+}
+
+
+/* render all snapshots that are new or changed, to be called outside of display-list building, returns the number rendered */
+uint8_t EVE_snapshot_update(void)
+{
+	uint32_t hash;
+	uint8_t pclk = 0;
+	uint8_t count = 0;
+	uint8_t id;
+
+	for(id = 0; id < snapshot_count; id++)
+	{
+		hash = eve_fnv1a(EVE_FNV1A_INIT, snapshots[id].data, snapshots[id].size);
+		if(hash != snapshots[id].hash)
+		{
+			snapshots[id].hash = hash;
+			snapshots[id].valid = 0;
+		}
+
+		if(!snapshots[id].valid)
+		{
+			if(count == 0)
+			{
+				while(EVE_busy());
+				pclk = EVE_memRead8(REG_PCLK);
+				EVE_memWrite8(REG_PCLK, 0);
+			}
+			snapshot_render(&snapshots[id]);
+			count++;
+		}
+	}
+
+	if(count != 0)
+	{
+		EVE_memWrite8(REG_PCLK, pclk);
+	}
+	return count;
+}
+
+
+void EVE_snapshot_draw_burst(uint8_t id, int16_t x, int16_t y)
+{
+	const eve_snapshot *snapshot;
+	uint16_t stride;
+
+	if((id >= snapshot_count) || !snapshots[id].valid)
+	{
+		return;
+	}
+
+	snapshot = &snapshots[id];
+	stride = snapshot->w * 2U;
+
+	EVE_cmd_dl_burst(BITMAP_HANDLE(EVE_SNAPSHOT_HANDLE));
+	EVE_cmd_dl_burst(BITMAP_SOURCE(snapshot->address));
+	EVE_cmd_dl_burst(BITMAP_LAYOUT(snapshot->format, stride, snapshot->h));
+	EVE_cmd_dl_burst(BITMAP_LAYOUT_H(stride, snapshot->h));
+	EVE_cmd_dl_burst(BITMAP_SIZE(EVE_NEAREST, EVE_BORDER, EVE_BORDER, snapshot->w, snapshot->h));
+	EVE_cmd_dl_burst(BITMAP_SIZE_H(snapshot->w, snapshot->h));
+	EVE_cmd_dl_burst(DL_BEGIN | EVE_BITMAPS);
+	EVE_cmd_dl_burst(VERTEX2F(x * 16, y * 16));
+	EVE_cmd_dl_burst(DL_END);
+}
+
+
+void EVE_snapshot_get_stats(EVE_snapshot_stats *stats)
+{
+	*stats = snapshot_stats;
+}
+
+#endif /* EVE_NO_BURST */
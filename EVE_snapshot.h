@@ -0,0 +1,97 @@
+/*
+@file    EVE_snapshot.h
+@brief   render-to-texture cache, expensive content is rendered once into a bitmap in RAM_G with CMD_SNAPSHOT2
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+Gradients, a CMD_CLOCK face or blended layers of icons are rendered again for every line of every frame,
+with a lot of this on a 800x480 display EVE can run out of time for a line.
+This module renders such content once and copies it with CMD_SNAPSHOT2 into a bitmap in RAM_G,
+from then on it is drawn as a single bitmap.
+
+EVE_snapshot_init(EVE_RAM_G_SIZE - 0x40000, 0x40000); <- the area of RAM_G for the bitmaps
+face = EVE_snapshot_add(draw_face, NULL, &face_color, sizeof(face_color), 0, 0, 200, 200, EVE_ARGB4);
+
+EVE_snapshot_update(); <- outside of display-list building, renders everything that is new or changed
+
+and in the frame:
+
+EVE_snapshot_draw_burst(face, 300, 140);
+
+The draw function uses the EVE_cmd_xxx_burst() functions to draw the content, at the position given to EVE_snapshot_add(),
+this area has to be within the screen.
+The content is rendered on a cleared screen, with EVE_ARGB4 everything that is not drawn is transparent.
+Changes of the data are detected with a hash over the bound data, EVE_snapshot_invalidate() marks a snapshot as changed.
+EVE_snapshot_update() turns off the pixel clock while it renders, as the programming guide recommends for snapshots,
+the display shows the last frame during this time, a frame has to be sent after it.
+The bitmaps use bitmap handle EVE_SNAPSHOT_HANDLE and the default VERTEX_FORMAT(4), EVE_bitmap.c does not hand it out.
+Every snapshot takes w * h * 2 bytes of RAM_G, EVE_snapshot_add() returns EVE_SNAPSHOT_NONE when this does not fit anymore.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_SNAPSHOT_H_
+#define EVE_SNAPSHOT_H_
+
+#include "EVE_commands.h"
+
+#if !defined (EVE_NO_BURST)
+
+/* max. number of snapshots */
+#if !defined (EVE_SNAPSHOT_MAX)
+#define EVE_SNAPSHOT_MAX 8U
+#endif
+
+#if !defined (EVE_SNAPSHOT_HANDLE)
+#define EVE_SNAPSHOT_HANDLE 14U
+#endif
+
+#define EVE_SNAPSHOT_NONE 0xffU
+
+typedef void (*EVE_snapshot_function)(void *context);
+
+typedef struct
+{
+	uint32_t renders; /* snapshots that were rendered */
+	uint32_t used;    /* bytes of RAM_G in use */
+	uint32_t size;    /* bytes of RAM_G given to EVE_snapshot_init() */
+} EVE_snapshot_stats;
+
+void EVE_snapshot_init(uint32_t base, uint32_t size);
+uint8_t EVE_snapshot_add(EVE_snapshot_function draw, void *context, const void *data, uint16_t size,
+						int16_t x, int16_t y, uint16_t w, uint16_t h, uint8_t format);
+void EVE_snapshot_invalidate(uint8_t id);
+uint8_t EVE_snapshot_update(void);
+void EVE_snapshot_draw_burst(uint8_t id, int16_t x, int16_t y);
+void EVE_snapshot_get_stats(EVE_snapshot_stats *stats);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_SNAPSHOT_H_ */
@@ -43,9 +43,18 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 - added a native ESP32 target with DMA
 - added an experimental ARDUINO_TEENSY41 target with DMA support - I do not have any Teensy to test this with
 - added ARDUINO_TEENSY35 to the experimental ARDUINO_TEENSY41 target
+- the native ESP32 target wakes up the EVE_rtos owner task from the end-of-DMA callback
+- added EVE_start_dma_transfer_buffer() to the native ESP32 target for the frame pipeline of EVE_rtos.c
+- EVE_dma_buffer and EVE_dma_buffer_index are task-local on the native ESP32 target with EVE_RTOS_PIPELINE
+- added a Linux target with spidev and the GPIO character device plus a capture mode for testing without hardware
+- the Linux target has a DMA buffer per thread, EVE_start_cmd_burst() sets up EVE_dma_buffer with EVE_dma_thread_buffer()
 
  */
 
+#if defined (__linux__) && !defined (_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L /* nanosleep() with -std=c99 */
+#endif
+
 #if !defined (ARDUINO)
 
   #include "EVE_target.h"
@@ -234,12 +243,19 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 		spi_device_handle_t EVE_spi_device = {0};
 		spi_device_handle_t EVE_spi_device_simple = {0};
 
+		#if defined (EVE_RTOS)
+			#include "EVE_rtos.h"
+		#endif
+
 		static void eve_spi_post_transfer_callback(void)
 		{
 			gpio_set_level(EVE_CS, 1); /* tell EVE to stop listen */
 			#if defined (EVE_DMA)
 				EVE_dma_busy = 0;
 			#endif
+			#if defined (EVE_RTOS)
+				EVE_rtos_notify_from_isr(); /* wake up the display owner task */
+			#endif
 			}
 
 		void EVE_init_spi(void)
@@ -284,8 +300,14 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 
 		#if defined (EVE_DMA)
 
+		#if defined (EVE_RTOS_PIPELINE)
+		static uint32_t eve_dma_memory[1025];
+		__thread uint32_t *EVE_dma_buffer = eve_dma_memory; /* the frame building task and the owner task use their own buffers */
+		__thread volatile uint16_t EVE_dma_buffer_index;
+		#else
 		uint32_t EVE_dma_buffer[1025];
 		volatile uint16_t EVE_dma_buffer_index;
+		#endif
 		volatile uint8_t EVE_dma_busy = 0;
 
 		void EVE_init_dma(void)
@@ -306,9 +328,310 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 			EVE_dma_busy = 42;
 		}
 
+		/* same as EVE_start_dma_transfer() but for a buffer other than EVE_dma_buffer, buffer[0] is not sent as the address is fixed */
+		/* the transaction is static as the driver may still need it after this function returned */
+		void EVE_start_dma_transfer_buffer(const uint32_t *buffer, uint16_t count)
+		{
+			static spi_transaction_t trans;
+
+			trans.tx_buffer = (const uint8_t *) &buffer[1];
+			trans.length = (count-1) * 4 * 8;
+			trans.addr = 0x00b02578; // WRITE + REG_CMDB_WRITE;
+			EVE_dma_busy = 42; /* before the transfer is queued as the callback could be faster */
+			gpio_set_level(EVE_CS, 0); /* make EVE listen */
+			spi_device_queue_trans(EVE_spi_device, &trans, portMAX_DELAY);
+		}
+
 		#endif /* DMA */
 		#endif /* ESP32 */
 
+/*----------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------*/
+
+		#if defined (__linux__)
+
+		#include <fcntl.h>
+		#include <pthread.h>
+		#include <string.h>
+		#include <time.h>
+		#include <unistd.h>
+		#include <sys/ioctl.h>
+		#include <linux/gpio.h>
+		#include <linux/spi/spidev.h>
+
+		/*
+		The bytes of a transfer are collected in tx_buffer and are sent with one ioctl() when the buffer is full,
+		when a byte is to be received or with EVE_cs_clear().
+		CS is a GPIO and not the CS of the SPI so it stays low between these ioctl() calls.
+		The bus is locked from EVE_cs_set() to EVE_cs_clear(), several threads can use the library that way as long
+		as every one of them only uses complete transfers.
+		*/
+
+		#define EVE_LINUX_BUFFER 4096U /* the default bufsiz of spidev */
+
+		static pthread_mutex_t eve_bus = PTHREAD_MUTEX_INITIALIZER;
+		static int eve_spi_fd = -1;
+		static int eve_cs_fd = -1;
+		static int eve_pdn_fd = -1;
+		static FILE *eve_capture = NULL;
+
+		static uint8_t tx_buffer[EVE_LINUX_BUFFER];
+		static uint8_t rx_buffer[EVE_LINUX_BUFFER];
+		static uint32_t tx_count;
+		static uint32_t capture_count; /* bytes in the current transfer, for the capture mode */
+		static uint32_t capture_address;
+
+		void DELAY_MS(uint16_t ms)
+		{
+			struct timespec delay;
+
+			delay.tv_sec = ms / 1000U;
+			delay.tv_nsec = (long) (ms % 1000U) * 1000000L;
+			nanosleep(&delay, NULL);
+		}
+
+		static int eve_gpio_request(int chip, uint32_t line, uint8_t value)
+		{
+			struct gpiohandle_request request = {0};
+
+			request.lineoffsets[0] = line;
+			request.lines = 1;
+			request.flags = GPIOHANDLE_REQUEST_OUTPUT;
+			request.default_values[0] = value;
+			strcpy(request.consumer_label, "EVE");
+
+			if(ioctl(chip, GPIO_GET_LINEHANDLE_IOCTL, &request) < 0)
+			{
+				return -1;
+			}
+			return request.fd;
+		}
+
+		static void eve_gpio_set(int line, uint8_t value)
+		{
+			struct gpiohandle_data data = {0};
+
+			if(line >= 0)
+			{
+				data.values[0] = value;
+				ioctl(line, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+			}
+		}
+
+		void EVE_init_spi(void)
+		{
+			uint8_t mode = SPI_MODE_0 | SPI_NO_CS;
+			uint8_t bits = 8;
+			uint32_t speed = EVE_SPI_SPEED;
+			int chip;
+
+			eve_spi_fd = open(EVE_SPI_DEVICE, O_RDWR);
+			if(ioctl(eve_spi_fd, SPI_IOC_WR_MODE, &mode) < 0)
+			{
+				mode = SPI_MODE_0; /* the controller does not support SPI_NO_CS, its own CS must not be connected to EVE */
+				ioctl(eve_spi_fd, SPI_IOC_WR_MODE, &mode);
+			}
+			ioctl(eve_spi_fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
+			ioctl(eve_spi_fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
+
+			chip = open(EVE_GPIO_CHIP, O_RDWR);
+			eve_cs_fd = eve_gpio_request(chip, EVE_CS, 1);
+			eve_pdn_fd = eve_gpio_request(chip, EVE_PDN, 0);
+			close(chip); /* the line handles stay valid */
+		}
+
+		/* instead of EVE_init_spi(), all transfers are written to "file" as one line each, "W" or "R", the address and the data */
+		/* reads return the values EVE_init() and EVE_busy() are waiting for and 0 otherwise */
+		void EVE_init_capture(FILE *file)
+		{
+			eve_capture = file;
+		}
+
+		static uint8_t eve_capture_read(uint32_t address)
+		{
+			switch(address)
+			{
+				case REG_ID:
+					return 0x7c;
+				case REG_CMDB_SPACE:
+					return 0xfc;
+				case REG_CMDB_SPACE + 1:
+					return 0x0f;
+				default:
+					return 0;
+			}
+		}
+
+		static void eve_capture_byte(uint8_t data, uint8_t *result)
+		{
+			if(capture_count < 3)
+			{
+				capture_address = (capture_address << 8) | data;
+				if(capture_count == 2)
+				{
+					fprintf(eve_capture, "%c %06x", (capture_address & 0x800000UL) ? 'W' : 'R', (unsigned int) (capture_address & 0x3fffffUL));
+				}
+			}
+			else if(capture_address & 0x800000UL)
+			{
+				fprintf(eve_capture, " %02x", data);
+			}
+			else if(capture_count > 3) /* the fourth byte of a read is the dummy byte */
+			{
+				*result = eve_capture_read((capture_address & 0x3fffffUL) + (capture_count - 4U));
+				fprintf(eve_capture, " %02x", *result);
+			}
+			capture_count++;
+		}
+
+		/* send what is in tx_buffer, returns the byte received with the last byte sent */
+		static uint8_t eve_flush(void)
+		{
+			struct spi_ioc_transfer transfer;
+			uint8_t result = 0;
+			uint32_t index;
+
+			if(tx_count == 0)
+			{
+				return 0;
+			}
+
+			if(eve_capture != NULL)
+			{
+				for(index = 0; index < tx_count; index++)
+				{
+					eve_capture_byte(tx_buffer[index], &result);
+				}
+			}
+			else
+			{
+				memset(&transfer, 0, sizeof(transfer));
+				transfer.tx_buf = (uintptr_t) tx_buffer;
+				transfer.rx_buf = (uintptr_t) rx_buffer;
+				transfer.len = tx_count;
+				transfer.speed_hz = EVE_SPI_SPEED;
+				transfer.bits_per_word = 8;
+				ioctl(eve_spi_fd, SPI_IOC_MESSAGE(1), &transfer);
+				result = rx_buffer[tx_count - 1U];
+			}
+
+			tx_count = 0;
+			return result;
+		}
+
+		void EVE_cs_set(void)
+		{
+			pthread_mutex_lock(&eve_bus);
+			tx_count = 0;
+			capture_count = 0;
+			capture_address = 0;
+			eve_gpio_set(eve_cs_fd, 0);
+		}
+
+		void EVE_cs_clear(void)
+		{
+			eve_flush();
+			if(eve_capture != NULL)
+			{
+				fputc('\n', eve_capture);
+			}
+			eve_gpio_set(eve_cs_fd, 1);
+			pthread_mutex_unlock(&eve_bus);
+		}
+
+		void EVE_pdn_set(void)
+		{
+			eve_gpio_set(eve_pdn_fd, 0);
+		}
+
+		void EVE_pdn_clear(void)
+		{
+			eve_gpio_set(eve_pdn_fd, 1);
+		}
+
+		void spi_transmit(uint8_t data)
+		{
+			if(tx_count == EVE_LINUX_BUFFER)
+			{
+				eve_flush();
+			}
+			tx_buffer[tx_count++] = data;
+		}
+
+		void spi_transmit_32(uint32_t data)
+		{
+			spi_transmit((uint8_t)(data));
+			spi_transmit((uint8_t)(data >> 8));
+			spi_transmit((uint8_t)(data >> 16));
+			spi_transmit((uint8_t)(data >> 24));
+		}
+
+		void spi_transmit_buffer(const uint8_t *data, uint32_t length)
+		{
+			uint32_t count;
+
+			while(length > 0)
+			{
+				if(tx_count == EVE_LINUX_BUFFER)
+				{
+					eve_flush();
+				}
+				count = EVE_LINUX_BUFFER - tx_count;
+				if(count > length)
+				{
+					count = length;
+				}
+				memcpy(&tx_buffer[tx_count], data, count);
+				tx_count += count;
+				data += count;
+				length -= count;
+			}
+		}
+
+		uint8_t spi_receive(uint8_t data)
+		{
+			spi_transmit(data);
+			return eve_flush();
+		}
+
+		#if defined (EVE_DMA)
+
+		static __thread uint32_t eve_dma_memory[1025];
+		__thread uint32_t *EVE_dma_buffer;
+		__thread volatile uint16_t EVE_dma_buffer_index;
+		volatile uint8_t EVE_dma_busy = 0;
+
+		void EVE_init_dma(void)
+		{
+		}
+
+		/* the buffer of the calling thread, a thread-local variable can not be initialised with the address of another one */
+		uint32_t *EVE_dma_thread_buffer(void)
+		{
+			return eve_dma_memory;
+		}
+
+		/* the transfer is done when this returns so EVE_dma_busy is never set */
+		void EVE_start_dma_transfer_buffer(const uint32_t *buffer, uint16_t count)
+		{
+			uint32_t address = buffer[0] >> 8; /* 0x low mid hi */
+
+			EVE_cs_set();
+			spi_transmit((uint8_t)(address));
+			spi_transmit((uint8_t)(address >> 8));
+			spi_transmit((uint8_t)(address >> 16));
+			spi_transmit_buffer((const uint8_t *) &buffer[1], (count - 1U) * 4U);
+			EVE_cs_clear();
+		}
+
+		void EVE_start_dma_transfer(void)
+		{
+			EVE_start_dma_transfer_buffer(EVE_dma_buffer, EVE_dma_buffer_index);
+		}
+
+		#endif /* DMA */
+		#endif /* __linux__ */
+
     #endif /* __GNUC__ */
 
 /*----------------------------------------------------------------------------------------------------------------*/
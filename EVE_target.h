@@ -68,6 +68,12 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 - Bugfix: the generic Arduino target was missing EVE_cs_set() / EVE_cs_clear()
 - added a native ESP32 target with DMA
 - missing note: Robert S. added an AVR XMEGA target by pull-request on Github
+- added an optional EVE_INT pin to the native ESP32 target for EVE_rtos.c
+- added EVE_start_dma_transfer_buffer() to the native ESP32 target for the frame pipeline of EVE_rtos.c
+- EVE_dma_buffer and EVE_dma_buffer_index are task-local on the native ESP32 target with EVE_RTOS_PIPELINE
+- added a Linux target with spidev and the GPIO character device plus a capture mode for testing without hardware
+- the Linux target has a DMA buffer per thread, EVE_start_cmd_burst() sets up EVE_dma_buffer with EVE_dma_thread_buffer()
+- the Linux target does not enable EVE_DMA with EVE_NO_BURST
 - added an experimental ARDUINO_TEENSY41 target with DMA support - I do not have any Teensy to test this with
 - added a target for the Raspberry Pi Pico - RP2040
 - added a target for Arduino-BBC_MICROBIT_V2
@@ -844,6 +850,7 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 		#define EVE_SCK		GPIO_NUM_18
 		#define EVE_MISO	GPIO_NUM_19
 		#define EVE_MOSI	GPIO_NUM_23
+//		#define EVE_INT		GPIO_NUM_4 /* optional, used by EVE_rtos.c to sleep until the command-fifo is empty */
 
 		extern spi_device_handle_t EVE_spi_device;
 		extern spi_device_handle_t EVE_spi_device_simple;
@@ -877,12 +884,18 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 		}
 
 		#if defined (EVE_DMA)
-			extern uint32_t EVE_dma_buffer[1025];
-			extern volatile uint16_t EVE_dma_buffer_index;
+			#if defined (EVE_RTOS_PIPELINE)
+				extern __thread uint32_t *EVE_dma_buffer; /* per task, the frame building task points it into the frame ring of EVE_rtos.c */
+				extern __thread volatile uint16_t EVE_dma_buffer_index;
+			#else
+				extern uint32_t EVE_dma_buffer[1025];
+				extern volatile uint16_t EVE_dma_buffer_index;
+			#endif
 			extern volatile uint8_t EVE_dma_busy;
 
 			void EVE_init_dma(void);
 			void EVE_start_dma_transfer(void);
+			void EVE_start_dma_transfer_buffer(const uint32_t *buffer, uint16_t count);
 		#endif
 
 		static inline void spi_transmit(uint8_t data)
@@ -1021,6 +1034,76 @@ TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR TH
 
 	#endif /* RP2040 */
 
+/*----------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------*/
+
+		#if defined (__linux__)
+		/* Linux on single board computers like the Raspberry Pi, SPI thru spidev and CS / PD thru the GPIO character device */
+		/* EVE_init_capture() replaces EVE_init_spi() to record all transfers to a file instead, for testing without hardware */
+
+		#include <stdint.h>
+		#include <stdio.h>
+
+		#if !defined (EVE_SPI_DEVICE)
+		#define EVE_SPI_DEVICE	"/dev/spidev0.0"
+		#endif
+
+		#if !defined (EVE_GPIO_CHIP)
+		#define EVE_GPIO_CHIP	"/dev/gpiochip0"
+		#endif
+
+		#define EVE_CS 		8	/* GPIO line numbers */
+		#define EVE_PDN		25
+		#define EVE_SPI_SPEED	10000000UL
+
+		#if !defined (EVE_DMA) && !defined (EVE_NO_BURST)
+		#define EVE_DMA /* "DMA" is a single write() for a whole burst here, this saves a lot of system calls */
+		#endif
+
+		void DELAY_MS(uint16_t ms);
+
+		void EVE_init_spi(void);
+		void EVE_init_capture(FILE *file);
+
+		void EVE_cs_set(void);
+		void EVE_cs_clear(void);
+		void EVE_pdn_set(void);
+		void EVE_pdn_clear(void);
+
+		#if defined (EVE_DMA)
+			#define EVE_DMA_THREAD /* every thread has a buffer of its own, it is set up with the first burst of the thread */
+			extern __thread uint32_t *EVE_dma_buffer; /* NULL until then */
+			extern __thread volatile uint16_t EVE_dma_buffer_index;
+			uint32_t *EVE_dma_thread_buffer(void);
+			extern volatile uint8_t EVE_dma_busy;
+
+			void EVE_init_dma(void);
+			void EVE_start_dma_transfer(void);
+			void EVE_start_dma_transfer_buffer(const uint32_t *buffer, uint16_t count);
+		#endif
+
+		void spi_transmit(uint8_t data);
+		void spi_transmit_32(uint32_t data);
+		void spi_transmit_buffer(const uint8_t *data, uint32_t length);
+		uint8_t spi_receive(uint8_t data);
+
+		/* spi_transmit_burst() is only used for cmd-FIFO commands so it *always* has to transfer 4 bytes */
+		static inline void spi_transmit_burst(uint32_t data)
+		{
+			#if defined (EVE_DMA)
+				EVE_dma_buffer[EVE_dma_buffer_index++] = data;
+			#else
+				spi_transmit_32(data);
+			#endif
+		}
+
+		static inline uint8_t fetch_flash_byte(const uint8_t *data)
+		{
+			return *data;
+		}
+
+	#endif /* __linux__ */
+
 	#endif /* __GNUC__ */
 
 /*----------------------------------------------------------------------------------------------------------------*/
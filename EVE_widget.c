@@ -0,0 +1,380 @@
+/*
+@file    EVE_widget.c
+@brief   retained widget tree that only encodes the widgets that changed
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+See EVE_widget.h for how to use this.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#include <string.h>
+
+#include "EVE_widget.h"
+#include "EVE_commands_private.h"
+
+#if !defined (EVE_NO_BURST)
+
+typedef struct
+{
+	EVE_widget_props props;
+	uint32_t text_hash;
+	uint16_t words;    /* first word in the pool */
+	uint16_t capacity; /* words reserved in the pool */
+	uint16_t count;    /* words used by the encoded widget */
+	uint8_t type;
+	uint8_t parent;
+	uint8_t child;     /* first child */
+	uint8_t next;      /* next sibling */
+	uint8_t dirty;
+} widget_node;
+
+static widget_node nodes[EVE_WIDGET_MAX];
+static uint32_t pool[EVE_WIDGET_WORDS];
+static uint16_t pool_used;
+static uint8_t num_nodes;
+static EVE_widget_stats widget_stats;
+
+/* words for each type without the text, TAG and COLOR_RGB included */
+static const uint8_t type_words[] = {0, 8, 9, 9, 5, 7, 7, 7};
+
+
+static uint32_t text_hash(const char *text)
+{
+	return (text != 0) ? eve_fnv1a(EVE_FNV1A_INIT, text, strlen(text)) : EVE_FNV1A_INIT;
+}
+
+
+void EVE_widget_init(void)
+{
+	num_nodes = 0;
+	pool_used = 0;
+}
+
+
+/* returns the id of the new widget or EVE_WIDGET_NONE when the pools are full */
+/* max_text is the max. length of the text it shows, this is only used for buttons and texts */
+uint8_t EVE_widget_add(uint8_t parent, uint8_t type, const EVE_widget_props *props, uint16_t max_text)
+{
+	widget_node *node;
+	uint16_t capacity;
+	uint8_t id;
+	uint8_t last;
+
+	if((num_nodes >= EVE_WIDGET_MAX) || (type > EVE_WIDGET_LINE) || ((parent != EVE_WIDGET_NONE) && (parent >= num_nodes)))
+	{
+		return EVE_WIDGET_NONE;
+	}
+
+	capacity = type_words[type];
+	if((type == EVE_WIDGET_BUTTON) || (type == EVE_WIDGET_TEXT))
+	{
+		capacity += (max_text / 4U) + 1U; /* the terminating zero needs a word if max_text is a multiple of four */
+	}
+
+	if(capacity > (EVE_WIDGET_WORDS - pool_used))
+	{
+		return EVE_WIDGET_NONE;
+	}
+
+	id = num_nodes++;
+	node = &nodes[id];
+	node->props = *props;
+	node->text_hash = text_hash(props->text);
+	node->words = pool_used;
+	node->capacity = capacity;
+	node->count = 0;
+	node->type = type;
+	node->parent = parent;
+	node->child = EVE_WIDGET_NONE;
+	node->next = EVE_WIDGET_NONE;
+	node->dirty = 42;
+	pool_used += capacity;
+
+	if(parent != EVE_WIDGET_NONE) /* add it as the last child, the order of children is the order they are drawn in */
+	{
+		if(nodes[parent].child == EVE_WIDGET_NONE)
+		{
+			nodes[parent].child = id;
+		}
+		else
+		{
+			last = nodes[parent].child;
+			while(nodes[last].next != EVE_WIDGET_NONE)
+			{
+				last = nodes[last].next;
+			}
+			nodes[last].next = id;
+		}
+	}
+	return id;
+}
+
+
+/* marks the widget and everything in it as changed */
+void EVE_widget_invalidate(uint8_t id)
+{
+	uint8_t child;
+
+	if(id < num_nodes)
+	{
+		nodes[id].dirty = 42;
+		for(child = nodes[id].child; child != EVE_WIDGET_NONE; child = nodes[child].next)
+		{
+			EVE_widget_invalidate(child);
+		}
+	}
+}
+
+
+/* returns the properties for changing them directly, the widget is encoded again with the next frame */
+EVE_widget_props *EVE_widget_edit(uint8_t id)
+{
+	if(id >= num_nodes)
+	{
+		return 0;
+	}
+	EVE_widget_invalidate(id);
+	return &nodes[id].props;
+}
+
+
+void EVE_widget_set_value(uint8_t id, uint16_t value)
+{
+	if((id < num_nodes) && (nodes[id].props.value != value))
+	{
+		nodes[id].props.value = value;
+		nodes[id].dirty = 42;
+	}
+}
+
+
+void EVE_widget_set_text(uint8_t id, const char *text)
+{
+	uint32_t hash = text_hash(text);
+
+	if((id < num_nodes) && ((nodes[id].props.text != text) || (nodes[id].text_hash != hash)))
+	{
+		nodes[id].props.text = text;
+		nodes[id].text_hash = hash;
+		nodes[id].dirty = 42;
+	}
+}
+
+
+void EVE_widget_set_color(uint8_t id, uint32_t color)
+{
+	if((id < num_nodes) && (nodes[id].props.color != color))
+	{
+		nodes[id].props.color = color;
+		nodes[id].dirty = 42;
+	}
+}
+
+
+void EVE_widget_set_position(uint8_t id, int16_t x, int16_t y)
+{
+	if((id < num_nodes) && ((nodes[id].props.x != x) || (nodes[id].props.y != y)))
+	{
+		nodes[id].props.x = x;
+		nodes[id].props.y = y;
+		EVE_widget_invalidate(id);
+	}
+}
+
+
+void EVE_widget_set_hidden(uint8_t id, uint8_t hidden)
+{
+	if((id < num_nodes) && (nodes[id].props.hidden != hidden))
+	{
+		nodes[id].props.hidden = hidden;
+		EVE_widget_invalidate(id);
+	}
+}
+
+
+/* x and y are the absolute position of the widget */
+static void widget_encode(widget_node *node, int16_t x, int16_t y)
+{
+	const EVE_widget_props *props = &node->props;
+	uint32_t *words = &pool[node->words];
+	uint16_t count = 0;
+	uint16_t text;
+
+	if(node->type == EVE_WIDGET_GROUP)
+	{
+		node->count = 0;
+		return;
+	}
+
+	words[count++] = TAG(props->tag);
+	words[count++] = DL_COLOR_RGB | (props->color & 0x00ffffffUL);
+
+	switch(node->type)
+	{
+		case EVE_WIDGET_BUTTON:
+			words[count++] = CMD_FGCOLOR;
+			words[count++] = props->fgcolor;
+			words[count++] = CMD_BUTTON;
+			words[count++] = (uint16_t) x + ((uint32_t) (uint16_t) y << 16);
+			words[count++] = (uint16_t) props->w + ((uint32_t) (uint16_t) props->h << 16);
+			words[count++] = props->font + ((uint32_t) props->options << 16);
+			break;
+
+		case EVE_WIDGET_GAUGE:
+			words[count++] = CMD_BGCOLOR;
+			words[count++] = props->bgcolor;
+			words[count++] = CMD_GAUGE;
+			words[count++] = (uint16_t) x + ((uint32_t) (uint16_t) y << 16);
+			words[count++] = (uint16_t) props->w + ((uint32_t) props->options << 16);
+			words[count++] = props->major + ((uint32_t) props->minor << 16);
+			words[count++] = props->value + ((uint32_t) props->range << 16);
+			break;
+
+		case EVE_WIDGET_PROGRESS:
+			words[count++] = CMD_BGCOLOR;
+			words[count++] = props->bgcolor;
+			words[count++] = CMD_PROGRESS;
+			words[count++] = (uint16_t) x + ((uint32_t) (uint16_t) y << 16);
+			words[count++] = (uint16_t) props->w + ((uint32_t) (uint16_t) props->h << 16);
+			words[count++] = props->options + ((uint32_t) props->value << 16);
+			words[count++] = props->range;
+			break;
+
+		case EVE_WIDGET_TEXT:
+			words[count++] = CMD_TEXT;
+			words[count++] = (uint16_t) x + ((uint32_t) (uint16_t) y << 16);
+			words[count++] = props->font + ((uint32_t) props->options << 16);
+			break;
+
+		case EVE_WIDGET_BITMAP:
+			words[count++] = BITMAP_HANDLE(props->font);
+			words[count++] = CELL(props->cell);
+			words[count++] = BEGIN(EVE_BITMAPS);
+			words[count++] = VERTEX2F(x * 16, y * 16);
+			words[count++] = END();
+			break;
+
+		default: /* EVE_WIDGET_RECT, EVE_WIDGET_LINE */
+			words[count++] = LINE_WIDTH(props->value);
+			words[count++] = BEGIN((node->type == EVE_WIDGET_RECT) ? EVE_RECTS : EVE_LINES);
+			words[count++] = VERTEX2F(x * 16, y * 16);
+			words[count++] = VERTEX2F((x + props->w) * 16, (y + props->h) * 16);
+			words[count++] = END();
+			break;
+	}
+
+	if((node->type == EVE_WIDGET_BUTTON) || (node->type == EVE_WIDGET_TEXT))
+	{
+		words[count] = 0; /* no text */
+		text = 1;
+		if(props->text != 0)
+		{
+			text = EVE_pack_string(&words[count], node->capacity - count, props->text);
+			if(text == 0) /* too long for the space reserved with EVE_widget_add(), cut it to the packed bytes */
+			{
+				text = node->capacity - count;
+				words[count + text - 1U] &= 0x00ffffffUL;
+			}
+		}
+		count += text;
+	}
+
+	node->count = count;
+	widget_stats.encoded++;
+	widget_stats.words_encoded += count;
+}
+
+
+static void widget_emit(widget_node *node, int16_t x, int16_t y)
+{
+	if(node->dirty)
+	{
+		widget_encode(node, x, y);
+		node->dirty = 0;
+	}
+	else
+	{
+		widget_stats.kept++;
+		widget_stats.words_kept += node->count;
+	}
+
+	private_words_write_burst(&pool[node->words], node->count);
+}
+
+
+/* x and y are the absolute position of the parent */
+static void widget_render(uint8_t id, int16_t x, int16_t y)
+{
+	widget_node *node;
+
+	while(id != EVE_WIDGET_NONE)
+	{
+		node = &nodes[id];
+
+		if(!node->props.hidden)
+		{
+			widget_emit(node, x + node->props.x, y + node->props.y);
+			widget_render(node->child, x + node->props.x, y + node->props.y);
+		}
+		id = node->next;
+	}
+}
+
+
+/* sends the widget root and everything in it, the widgets that changed are encoded again */
+void EVE_widget_render_burst(uint8_t root)
+{
+	widget_node *node;
+	int16_t x = 0;
+	int16_t y = 0;
+	uint8_t parent;
+
+	if((root < num_nodes) && !nodes[root].props.hidden)
+	{
+		node = &nodes[root];
+
+		for(parent = node->parent; parent != EVE_WIDGET_NONE; parent = nodes[parent].parent)
+		{
+			x += nodes[parent].props.x;
+			y += nodes[parent].props.y;
+		}
+
+		widget_emit(node, x + node->props.x, y + node->props.y);
+		widget_render(node->child, x + node->props.x, y + node->props.y);
+	}
+}
+
+
+void EVE_widget_get_stats(EVE_widget_stats *stats)
+{
+	*stats = widget_stats;
+}
+
+#endif /* EVE_NO_BURST */
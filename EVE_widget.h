@@ -0,0 +1,154 @@
+/*
+@file    EVE_widget.h
+@brief   retained widget tree that only encodes the widgets that changed
+@version 5.0
+@date    2026-10-18
+@author  Rudolph Riedel
+
+@section info
+
+The widgets of a page are added once to a tree, each with its properties like position, value, text and colors.
+Every widget keeps the words it was encoded to in a pool, EVE_widget_render_burst() only encodes the widgets again
+that were changed since the last frame and sends the kept words for all others.
+Changing a group, its position or if it is hidden, changes all the widgets in it.
+All memory is in fixed pools, EVE_WIDGET_MAX nodes and EVE_WIDGET_WORDS words for the encoded widgets.
+
+EVE_widget_props props = {0};
+
+EVE_widget_init();
+page = EVE_widget_add(EVE_WIDGET_NONE, EVE_WIDGET_GROUP, &props, 0);
+props.x = 20; props.y = 20; props.w = 100; props.h = 16; props.range = 1000; props.color = WHITE; props.bgcolor = 0x202020;
+fuel = EVE_widget_add(page, EVE_WIDGET_PROGRESS, &props, 0);
+props.y = 50; props.font = 28; props.text = "Fuel";
+label = EVE_widget_add(page, EVE_WIDGET_TEXT, &props, 12); <- room for up to 12 characters
+
+and for every frame:
+
+EVE_widget_set_value(fuel, fuel_level); <- only marks the widget as changed if the value is different
+EVE_start_cmd_burst();
+EVE_cmd_dl_burst(CMD_DLSTART);
+...
+EVE_widget_render_burst(page);
+...
+EVE_end_cmd_burst();
+
+Positions are in pixels and relative to the parent group, bitmaps and primitives use VERTEX2F with the default VERTEX_FORMAT(4).
+Every widget sets its own TAG and COLOR_RGB and the co-processor colors it uses, so the order of encoded and kept
+widgets does not matter.
+The properties used by each type:
+- EVE_WIDGET_GROUP: x, y, hidden
+- EVE_WIDGET_BUTTON: x, y, w, h, font, options, text, color, fgcolor, tag
+- EVE_WIDGET_GAUGE: x, y, w as radius, options, major, minor, value, range, color, bgcolor, tag
+- EVE_WIDGET_PROGRESS: x, y, w, h, options, value, range, color, bgcolor, tag
+- EVE_WIDGET_TEXT: x, y, font, options, text, color, tag
+- EVE_WIDGET_BITMAP: x, y, font as bitmap handle, cell, color, tag
+- EVE_WIDGET_RECT / EVE_WIDGET_LINE: x, y, w, h, value as line-width in 1/16 pixel, color, tag
+
+The text is not copied, it has to stay valid until the next frame, EVE_widget_set_text() detects changes with a hash.
+A text that is longer than the max_text given to EVE_widget_add() is cut off to fit.
+After changing the properties thru the pointer from EVE_widget_edit() the widget is encoded again.
+tools/widget_bench.c shows that the time for a frame depends on the number of changed widgets.
+With EVE_DMA the words of the widgets that did not change are copied into EVE_dma_buffer with memcpy(),
+on a PC a page with only a few changes takes about half the time of building it with the EVE_cmd_xxx_burst() functions.
+
+
+@section LICENSE
+
+MIT License
+
+Copyright (c) 2016-2021 Rudolph Riedel
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+@section History
+
+5.0
+- initial version
+
+*/
+
+#pragma once
+
+#ifndef EVE_WIDGET_H_
+#define EVE_WIDGET_H_
+
+#include "EVE_commands.h"
+
+#if !defined (EVE_NO_BURST)
+
+/* max. number of widgets, groups included */
+#if !defined (EVE_WIDGET_MAX)
+#define EVE_WIDGET_MAX 64U
+#endif
+
+/* pool for the encoded words of all widgets */
+#if !defined (EVE_WIDGET_WORDS)
+#define EVE_WIDGET_WORDS 2048U
+#endif
+
+#define EVE_WIDGET_NONE 0xffU
+
+#define EVE_WIDGET_GROUP    0U
+#define EVE_WIDGET_BUTTON   1U
+#define EVE_WIDGET_GAUGE    2U
+#define EVE_WIDGET_PROGRESS 3U
+#define EVE_WIDGET_TEXT     4U
+#define EVE_WIDGET_BITMAP   5U
+#define EVE_WIDGET_RECT     6U
+#define EVE_WIDGET_LINE     7U
+
+typedef struct
+{
+	const char *text;
+	uint32_t color;   /* COLOR_RGB */
+	uint32_t fgcolor; /* CMD_FGCOLOR */
+	uint32_t bgcolor; /* CMD_BGCOLOR */
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+	uint16_t options;
+	uint16_t value;
+	uint16_t range;
+	uint16_t major;
+	uint16_t minor;
+	uint8_t font;
+	uint8_t cell;
+	uint8_t tag;
+	uint8_t hidden;
+} EVE_widget_props;
+
+typedef struct
+{
+	uint32_t encoded;       /* widgets that were encoded */
+	uint32_t kept;          /* widgets that were sent from the pool */
+	uint32_t words_encoded;
+	uint32_t words_kept;
+} EVE_widget_stats;
+
+void EVE_widget_init(void);
+uint8_t EVE_widget_add(uint8_t parent, uint8_t type, const EVE_widget_props *props, uint16_t max_text);
+EVE_widget_props *EVE_widget_edit(uint8_t id);
+void EVE_widget_invalidate(uint8_t id);
+
+void EVE_widget_set_value(uint8_t id, uint16_t value);
+void EVE_widget_set_text(uint8_t id, const char *text);
+void EVE_widget_set_color(uint8_t id, uint32_t color);
+void EVE_widget_set_position(uint8_t id, int16_t x, int16_t y);
+void EVE_widget_set_hidden(uint8_t id, uint8_t hidden);
+
+void EVE_widget_render_burst(uint8_t root);
+void EVE_widget_get_stats(EVE_widget_stats *stats);
+
+#endif /* EVE_NO_BURST */
+
+#endif /* EVE_WIDGET_H_ */
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# eve_astc.py - encodes images to ASTC for BT81x and packs them into a binary for the external flash
+# with a header that has EVE_bitmap_image initializers for them, see EVE_bitmap.h.
+#
+# usage: python3 tools/eve_astc.py --base 0x1000 -o astc_images.bin --header astc_images.h name=file[:BLOCK] [...]
+#
+# PNG files are encoded with astcenc, the ASTC encoder from ARM, it needs to be installed or passed with --astcenc.
+# Files with the extension .astc are taken as they are, as written by astcenc or other encoders.
+# BLOCK is the block size like 8x8, --block sets it for all images, 4x4 is 8 bits per pixel, 8x8 is 2 bits per pixel.
+# BT81x does not use the blocks in the order of the .astc file, the blocks are stored in tiles of 2x2 blocks:
+# top-left, bottom-left, bottom-right, top-right, the tiles go from left to right and from top to bottom.
+# A last single column is stored top to bottom and a last single row left to right.
+# --linear keeps the order of the file.
+# Every image starts on a 64 byte boundary, BITMAP_SOURCE2 addresses the flash in units of 32 bytes
+# and CMD_FLASHREAD needs 64.
+# --base is the address in the flash the binary is written to, it has to be a multiple of 64 and
+# should be 4096 or more as the first 4096 bytes of the flash are the blob for BT81x.
+# A report with the address, the bits per pixel and the bytes of every image is printed.
+
+import argparse
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+ALIGN = 64
+ASTC_MAGIC = 0x5CA1AB13
+
+# block size: offset from EVE_COMPRESSED_RGBA_ASTC_4x4_KHR
+BLOCKS = ["4x4", "5x4", "5x5", "6x5", "6x6", "8x5", "8x6", "8x8", "10x5", "10x6", "10x8", "10x10", "12x10", "12x12"]
+
+
+def c_name(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def encode(path, block, astcenc, quality):
+    """runs astcenc and returns the .astc file"""
+    handle, output = tempfile.mkstemp(suffix=".astc")
+    os.close(handle)
+    try:
+        subprocess.run([astcenc, "-cl", path, output, block, "-" + quality], check=True, stdout=subprocess.DEVNULL)
+        with open(output, "rb") as file:
+            return file.read()
+    except FileNotFoundError:
+        sys.exit("%s not found, install the ASTC encoder from ARM, use --astcenc or use .astc files" % astcenc)
+    except subprocess.CalledProcessError as error:
+        sys.exit("%s: %s failed with %d" % (path, astcenc, error.returncode))
+    finally:
+        os.remove(output)
+
+
+def parse(path, data):
+    """returns the block size, the width, the height and the blocks of an .astc file"""
+    if len(data) < 16 or struct.unpack("<I", data[0:4])[0] != ASTC_MAGIC:
+        sys.exit("%s: not an .astc file" % path)
+    block_w, block_h, block_d = data[4], data[5], data[6]
+    width = int.from_bytes(data[7:10], "little")
+    height = int.from_bytes(data[10:13], "little")
+    depth = int.from_bytes(data[13:16], "little")
+    if block_d != 1 or depth != 1:
+        sys.exit("%s: 3D images are not supported" % path)
+    block = "%dx%d" % (block_w, block_h)
+    if block not in BLOCKS:
+        sys.exit("%s: block size %s is not supported by BT81x" % (path, block))
+    across = (width + block_w - 1) // block_w
+    down = (height + block_h - 1) // block_h
+    blocks = data[16:]
+    if len(blocks) != across * down * 16:
+        sys.exit("%s: expected %d blocks, found %d bytes" % (path, across * down, len(blocks)))
+    return block, width, height, across, down, blocks
+
+
+def tile(blocks, across, down):
+    """puts the blocks in the order of BT81x"""
+    def block(x, y):
+        start = (y * across + x) * 16
+        return blocks[start:start + 16]
+
+    result = bytearray()
+    for y in range(0, down, 2):
+        for x in range(0, across, 2):
+            if y + 1 < down and x + 1 < across:
+                result += block(x, y) + block(x, y + 1) + block(x + 1, y + 1) + block(x + 1, y)
+            elif y + 1 < down:
+                result += block(x, y) + block(x, y + 1)
+            elif x + 1 < across:
+                result += block(x, y) + block(x + 1, y)
+            else:
+                result += block(x, y)
+    return bytes(result)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="encode images to ASTC and pack them for the flash attached to BT81x")
+    parser.add_argument("--base", type=lambda text: int(text, 0), default=0x1000, help="address of the binary in the flash")
+    parser.add_argument("--prefix", default="ASTC", help="prefix for the names in the header")
+    parser.add_argument("--block", default="8x8", help="ASTC block size for PNG files, one of: " + ", ".join(BLOCKS))
+    parser.add_argument("--quality", default="medium", choices=["fast", "medium", "thorough", "exhaustive"])
+    parser.add_argument("--astcenc", default="astcenc", help="the ASTC encoder")
+    parser.add_argument("--linear", action="store_true", help="keep the blocks in the order of the file")
+    parser.add_argument("-o", "--output", required=True, help="binary for the flash")
+    parser.add_argument("--header", required=True, help="header with the addresses and the EVE_bitmap_image initializers")
+    parser.add_argument("images", nargs="+", metavar="name=file[:BLOCK]")
+    args = parser.parse_args()
+
+    if args.base % ALIGN:
+        sys.exit("--base has to be a multiple of %d" % ALIGN)
+    if args.block not in BLOCKS:
+        sys.exit("--block has to be one of: " + ", ".join(BLOCKS))
+
+    prefix = c_name(args.prefix)
+    flash = bytearray()
+    entries = []
+
+    for image in args.images:
+        if "=" not in image:
+            sys.exit("%s: expected name=file" % image)
+        name, path = image.split("=", 1)
+        block = args.block
+        match = re.match(r"(.*):(\d+x\d+)$", path)
+        if match:
+            path, block = match.group(1), match.group(2)
+            if block not in BLOCKS:
+                sys.exit("%s: block size %s is not supported by BT81x" % (path, block))
+
+        if path.lower().endswith(".astc"):
+            with open(path, "rb") as file:
+                data = file.read()
+        else:
+            data = encode(path, block, args.astcenc, args.quality)
+
+        block, width, height, across, down, blocks = parse(path, data)
+        if not args.linear:
+            blocks = tile(blocks, across, down)
+
+        address = args.base + len(flash)
+        entries.append({"name": c_name(name), "path": path, "block": block, "width": width, "height": height,
+                        "stride": across * 16, "address": address, "size": len(blocks)})
+        flash += blocks
+        flash += b"\xff" * (-len(flash) % ALIGN)
+
+    if len(set(entry["name"] for entry in entries)) != len(entries):
+        sys.exit("the names have to be unique")
+
+    with open(args.output, "wb") as file:
+        file.write(flash)
+
+    guard = c_name(os.path.basename(args.header)) + "_"
+    with open(args.header, "w") as file:
+        file.write("/* generated by tools/eve_astc.py from: %s */\n" % " ".join(os.path.basename(e["path"]) for e in entries))
+        file.write("/* %s has to be written to the flash at 0x%06x */\n\n" % (os.path.basename(args.output), args.base))
+        file.write("#pragma once\n\n#ifndef %s\n#define %s\n\n#include \"EVE_bitmap.h\"\n\n" % (guard, guard))
+        file.write("#define %s_BASE 0x%06xUL\n" % (prefix, args.base))
+        file.write("#define %s_SIZE %uUL\n\n" % (prefix, len(flash)))
+        for entry in entries:
+            name = "%s_%s" % (prefix, entry["name"])
+            file.write("/* %s, %ux%u, ASTC %s */\n" % (os.path.basename(entry["path"]), entry["width"], entry["height"], entry["block"]))
+            file.write("#define %s_ADDRESS 0x%06xUL\n" % (name, entry["address"]))
+            file.write("#define %s_SIZE %uUL\n" % (name, entry["size"]))
+            file.write("#define %s_IMAGE {EVE_BITMAP_FLASH(%s_ADDRESS), EVE_COMPRESSED_RGBA_ASTC_%s_KHR, %uU, %uU, %uU, 0U}\n\n"
+                       % (name, name, entry["block"], entry["width"], entry["height"], entry["stride"]))
+        file.write("#endif /* %s */\n" % guard)
+
+    print("%-16s %-6s %9s %5s %10s %8s" % ("name", "block", "size", "bpp", "address", "bytes"))
+    for entry in entries:
+        block_w, block_h = (int(value) for value in entry["block"].split("x"))
+        print("%-16s %-6s %4ux%-4u %5.2f   0x%06x %8u" % (entry["name"], entry["block"], entry["width"], entry["height"],
+              128.0 / (block_w * block_h), entry["address"], entry["size"]))
+    print("%d images, %d bytes at 0x%06x" % (len(entries), len(flash), args.base))
+
+
+if __name__ == "__main__":
+    main()
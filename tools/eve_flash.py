@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+# eve_flash.py - lays out the image for the flash attached to BT81x from a manifest of assets
+# and writes a header with the addresses and sizes of the assets.
+#
+# usage: python3 tools/eve_flash.py manifest.json -o flash_image.bin --header flash_image.h [--map flash_image.map]
+#                                   [--array flash_image.c] [--update]
+#
+# The manifest is JSON:
+#
+# {
+#     "prefix": "FLASH",
+#     "blob": "unified.blob",
+#     "assets":
+#     [
+#         {"name": "font", "file": "notosans.xfont", "type": "xfont", "glyphs": "glyphs"},
+#         {"name": "glyphs", "file": "notosans.glyph"},
+#         {"name": "background", "file": "background.astc", "type": "astc"},
+#         {"name": "beep", "file": "beep.ulaw", "type": "audio"},
+#         {"name": "main_page", "file": "main_page.txt", "type": "dl"},
+#         {"name": "logo", "file": "logo.png", "type": "astc", "block": "4x4", "sector": true}
+#     ]
+# }
+#
+# Types:
+# - raw: the file as it is, this is the default, for bitmaps and the .glyph files of fonts
+# - xfont: the .xfont has to be copied to RAM_G with EVE_cmd_flashread(), "glyphs" names the asset with the .glyph file,
+#   the address of the glyphs in the .xfont is set to where that asset is placed as it can move with --map
+# - astc: .astc files or PNG files that are encoded with astcenc, the blocks are tiled like tools/eve_astc.py does it
+# - audio: raw samples, the length is padded to a multiple of 8 bytes as REG_PLAYBACK_LENGTH needs it
+# - dl: display-list words like for tools/flashdl.py, these get a table for EVE_flashdl_init()
+#
+# The first 4096 bytes of the flash are the blob that BT81x needs to switch to full-speed mode.
+# With "blob" the image starts at address 0 and has the blob in it, without the image starts at 4096.
+# Every asset starts on a 64 byte boundary as BITMAP_SOURCE2, CMD_FLASHREAD and CMD_APPENDF need this,
+# "sector": true starts it on a 4096 byte sector boundary instead and keeps the rest of its last sector free,
+# for assets that are updated on their own.
+# The sizes in the header are rounded up to a multiple of four as CMD_FLASHREAD needs this.
+#
+# With --map the layout is incremental, the map of the last run is read from the file and written back.
+# Assets that still fit into the space they had keep their address, the others are put into the first gap
+# they fit in or at the end.
+# The header lists the 4096 byte sectors that changed since the last run as FLASH_UPDATE,
+# only these need to be programmed with EVE_cmd_flashupdate().
+# The bytes that are not used by any asset are taken from the image of the last run, when its sectors still
+# match the map, so space that an asset moved away from does not count as changed.
+# --array writes the image compressed with zlib for CMD_INFLATE into a .c file, with --update it only has
+# the changed sectors, one after the other in the order of FLASH_UPDATE.
+#
+# Only the Python standard library is used.
+
+import argparse
+import binascii
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import eve_astc  # noqa: E402
+import flashdl  # noqa: E402
+
+ALIGN = 64
+SECTOR = 4096
+BLOB_SIZE = 4096
+FLASH_SIZE = 64 * 1024 * 1024
+TYPES = ("raw", "xfont", "astc", "audio", "dl")
+XFONT_SIGNATURE = 0x0100AAFF
+XFONT_GPTR = 32  # offset of start_of_graphic_data, the flash address / 32 with bit 23 set for glyphs in the flash
+
+
+def c_name(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def array_name(path):
+    return re.sub(r"[^A-Za-z0-9]", "_", os.path.splitext(os.path.basename(path))[0])
+
+
+def align(value, boundary):
+    return (value + boundary - 1) // boundary * boundary
+
+
+def load(asset, directory):
+    """returns the data of an asset and the extra information for the header"""
+    path = os.path.join(directory, asset["file"])
+    kind = asset.get("type", "raw")
+    if kind not in TYPES:
+        sys.exit("%s: unknown type %s" % (asset["name"], kind))
+
+    if kind == "astc":
+        if path.lower().endswith(".astc"):
+            with open(path, "rb") as file:
+                data = file.read()
+        else:
+            data = eve_astc.encode(path, asset.get("block", "8x8"), asset.get("astcenc", "astcenc"), "medium")
+        block, width, height, across, down, blocks = eve_astc.parse(path, data)
+        return eve_astc.tile(blocks, across, down), {"block": block, "width": width, "height": height, "stride": across * 16}
+
+    if kind == "dl":
+        words = flashdl.read_words(path)
+        if not words or len(words) * 4 > flashdl.RAM_DL_SIZE:
+            sys.exit("%s: needs 1 to %d display-list words" % (path, flashdl.RAM_DL_SIZE // 4))
+        return struct.pack("<%dI" % len(words), *words), {}
+
+    with open(path, "rb") as file:
+        data = file.read()
+    if kind == "audio":
+        data += b"\x00" * (-len(data) % 8)
+    return data, {}
+
+
+def link_xfont(asset, addresses):
+    """puts the flash address of the glyph asset into the start_of_graphic_data field of the .xfont"""
+    data = asset["data"]
+    if len(data) < 40 or struct.unpack("<I", data[0:4])[0] != XFONT_SIGNATURE:
+        sys.exit("%s: not an extended font, the signature is not 0x%08x" % (asset["file"], XFONT_SIGNATURE))
+    glyphs = asset.get("glyphs")
+    if glyphs is None:
+        sys.exit("%s: an xfont needs \"glyphs\" with the name of the asset for the .glyph file" % asset["name"])
+    if glyphs not in addresses or glyphs == asset["name"]:
+        sys.exit("%s: there is no asset %s for the glyphs" % (asset["name"], glyphs))
+    address = addresses[glyphs]
+    if address % 32:
+        sys.exit("%s: the glyphs need to be on a 32 byte boundary" % glyphs)
+    asset["data"] = data[0:XFONT_GPTR] + struct.pack("<I", 0x800000 | (address // 32)) + data[XFONT_GPTR + 4:]
+
+
+def read_map(path):
+    if path and os.path.exists(path):
+        with open(path, "r") as file:
+            return json.load(file)
+    return {"assets": {}, "sectors": []}
+
+
+def read_previous(path, old, base):
+    """returns the image of the last run if it still matches the sectors in the map, None otherwise"""
+    if old.get("base") != base or not old.get("sectors") or not os.path.exists(path):
+        return None
+    with open(path, "rb") as file:
+        previous = file.read()
+    sectors = [binascii.crc32(previous[offset:offset + SECTOR]) & 0xFFFFFFFF for offset in range(0, len(previous), SECTOR)]
+    return previous if sectors == old["sectors"] else None
+
+
+def reserved(asset):
+    """returns the bytes an asset takes, sector assets take the whole last sector as well"""
+    size = align(len(asset["data"]), 4)
+    return align(size, SECTOR) if asset.get("sector") else size
+
+
+def layout(assets, old, start):
+    """returns the address for every asset, assets keep their address when they still fit"""
+    old_assets = old.get("assets", {})
+    placed = {}
+    used = []  # (start, end) of the placed assets
+
+    starts = sorted(entry["address"] for entry in old_assets.values())
+    for asset in assets:
+        entry = old_assets.get(asset["name"])
+        if entry is None:
+            continue
+        address = entry["address"]
+        following = [value for value in starts if value > address]
+        room = (following[0] if following else align(address + entry["size"], SECTOR)) - address
+        boundary = SECTOR if asset.get("sector") else ALIGN
+        if address >= start and address % boundary == 0 and reserved(asset) <= room:
+            placed[asset["name"]] = address
+            used.append((address, address + reserved(asset)))
+
+    for asset in assets:
+        if asset["name"] in placed:
+            continue
+        boundary = SECTOR if asset.get("sector") else ALIGN
+        size = reserved(asset)
+        address = align(start, boundary)
+        for begin, end in sorted(used):
+            if address + size <= begin:
+                break
+            address = max(address, align(end, boundary))
+        placed[asset["name"]] = address
+        used.append((address, address + size))
+    return placed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="lay out the image for the flash attached to BT81x")
+    parser.add_argument("manifest", help="JSON file with the assets")
+    parser.add_argument("-o", "--output", required=True, help="binary for the flash")
+    parser.add_argument("--header", required=True, help="header with the addresses and sizes")
+    parser.add_argument("--map", help="map of the layout, read and written for incremental layouts")
+    parser.add_argument("--array", help=".c file with the image compressed for CMD_INFLATE")
+    parser.add_argument("--update", action="store_true", help="only put the changed sectors into --array")
+    args = parser.parse_args()
+
+    with open(args.manifest, "r") as file:
+        manifest = json.load(file)
+    directory = os.path.dirname(os.path.abspath(args.manifest))
+    prefix = c_name(manifest.get("prefix", "FLASH"))
+
+    blob = b""
+    if manifest.get("blob"):
+        with open(os.path.join(directory, manifest["blob"]), "rb") as file:
+            blob = file.read()
+        if len(blob) != BLOB_SIZE:
+            sys.exit("%s: the blob has to be %d bytes" % (manifest["blob"], BLOB_SIZE))
+    base = 0 if blob else BLOB_SIZE
+
+    assets = manifest.get("assets", [])
+    for asset in assets:
+        if "name" not in asset or "file" not in asset:
+            sys.exit("every asset needs a name and a file")
+        asset["data"], asset["info"] = load(asset, directory)
+    if len(set(c_name(asset["name"]) for asset in assets)) != len(assets):
+        sys.exit("the names have to be unique")
+
+    old = read_map(args.map)
+    addresses = layout(assets, old, BLOB_SIZE)
+    for asset in assets:
+        if asset.get("type") == "xfont":
+            link_xfont(asset, addresses)
+    end = max([addresses[asset["name"]] + len(asset["data"]) for asset in assets] + [BLOB_SIZE])
+    end = align(end, SECTOR)
+    if end > FLASH_SIZE:
+        sys.exit("the image needs %d bytes, that is more than the flash has" % end)
+
+    image = bytearray(b"\xff" * (end - base))
+    previous = read_previous(args.output, old, base) if args.map else None
+    if previous:
+        image[0:len(previous)] = previous[0:len(image)]  # the unused bytes are what is in the flash already
+    if blob:
+        image[0:BLOB_SIZE] = blob
+    for asset in assets:
+        offset = addresses[asset["name"]] - base
+        image[offset:offset + len(asset["data"])] = asset["data"]
+
+    sectors = [binascii.crc32(image[offset:offset + SECTOR]) & 0xFFFFFFFF for offset in range(0, len(image), SECTOR)]
+    old_sectors = old.get("sectors", []) if old.get("base") == base else []
+    changed = [index for index, crc in enumerate(sectors) if index >= len(old_sectors) or old_sectors[index] != crc]
+
+    ranges = []
+    for index in changed:
+        address = base + index * SECTOR
+        if ranges and ranges[-1][0] + ranges[-1][1] == address:
+            ranges[-1][1] += SECTOR
+        else:
+            ranges.append([address, SECTOR])
+
+    with open(args.output, "wb") as file:
+        file.write(image)
+
+    if args.map:
+        with open(args.map, "w") as file:
+            entries = {asset["name"]: {"address": addresses[asset["name"]], "size": len(asset["data"])} for asset in assets}
+            json.dump({"base": base, "assets": entries, "sectors": sectors}, file, indent=1)
+
+    if args.array:
+        if args.update:
+            data = b"".join(bytes(image[start - base:start - base + size]) for start, size in ranges)
+        else:
+            data = bytes(image)
+        compressed = zlib.compress(data, 9)
+        with open(args.array, "w") as file:
+            file.write("/* generated by tools/eve_flash.py from %s, %u bytes when inflated */\n\n" %
+                       (os.path.basename(args.manifest), len(data)))
+            file.write("#include \"%s\"\n\n" % os.path.basename(args.header))
+            file.write("const uint8_t %s[%u] PROGMEM =\n{\n" % (array_name(args.array), len(compressed)))
+            for start in range(0, len(compressed), 24):
+                file.write("\t" + ", ".join("0x%02x" % value for value in compressed[start:start + 24]) + ",\n")
+            file.write("};\n")
+
+    dls = [asset for asset in assets if asset.get("type") == "dl"]
+    astcs = [asset for asset in assets if asset.get("type") == "astc"]
+    guard = c_name(os.path.basename(args.header)) + "_"
+    with open(args.header, "w") as file:
+        file.write("/* generated by tools/eve_flash.py from %s */\n" % os.path.basename(args.manifest))
+        file.write("/* %s has to be written to the flash at 0x%06x */\n\n" % (os.path.basename(args.output), base))
+        file.write("#pragma once\n\n#ifndef %s\n#define %s\n\n" % (guard, guard))
+        file.write("#if defined (__AVR__)\n\t#include <avr/pgmspace.h>\n#else\n\t#include <stdint.h>\n")
+        file.write("\t#if !defined (PROGMEM)\n\t\t#define PROGMEM\n\t#endif\n#endif\n\n")
+        if astcs:
+            file.write("#include \"EVE_bitmap.h\"\n")
+        if dls:
+            file.write("#include \"EVE_flashdl.h\"\n")
+        if astcs or dls:
+            file.write("\n")
+        file.write("#define %s_BASE 0x%06xUL\n" % (prefix, base))
+        file.write("#define %s_SIZE %uUL\n\n" % (prefix, len(image)))
+
+        for asset in assets:
+            name = "%s_%s" % (prefix, c_name(asset["name"]))
+            info = asset["info"]
+            file.write("/* %s, %s */\n" % (asset["file"], asset.get("type", "raw")))
+            file.write("#define %s_ADDRESS 0x%06xUL\n" % (name, addresses[asset["name"]]))
+            file.write("#define %s_SIZE %uUL\n" % (name, align(len(asset["data"]), 4)))
+            if asset.get("type") == "astc":
+                file.write("#define %s_IMAGE {EVE_BITMAP_FLASH(%s_ADDRESS), EVE_COMPRESSED_RGBA_ASTC_%s_KHR, %uU, %uU, %uU, 0U}\n"
+                           % (name, name, info["block"], info["width"], info["height"], info["stride"]))
+            file.write("\n")
+
+        if dls:
+            file.write("#define %s_DL_COUNT %uU\n\n" % (prefix, len(dls)))
+            for index, asset in enumerate(dls):
+                file.write("#define %s_DL_%s %uU\n" % (prefix, c_name(asset["name"]), index))
+            file.write("\nstatic const EVE_flashdl_entry %s_DL_TABLE[%s_DL_COUNT] =\n{\n" % (prefix, prefix))
+            for asset in dls:
+                file.write("\t{0x%06xUL, %uUL, 0x%08xUL}, /* %s */\n" % (addresses[asset["name"]], len(asset["data"]),
+                           binascii.crc32(asset["data"]) & 0xFFFFFFFF, c_name(asset["name"])))
+            file.write("};\n\n")
+
+        file.write("/* the sectors that changed since the last layout, flash address and size for EVE_cmd_flashupdate() */\n")
+        file.write("#define %s_UPDATE_COUNT %uU\n\n" % (prefix, len(ranges)))
+        if ranges:
+            file.write("static const uint32_t %s_UPDATE[%s_UPDATE_COUNT][2] =\n{\n" % (prefix, prefix))
+            for start, size in ranges:
+                file.write("\t{0x%06xUL, %uUL},\n" % (start, size))
+            file.write("};\n\n")
+        if args.array:
+            file.write("extern const uint8_t %s[%u] PROGMEM;\n\n" % (array_name(args.array), len(compressed)))
+        file.write("#endif /* %s */\n" % guard)
+
+    print("%-20s %-6s %10s %8s" % ("name", "type", "address", "bytes"))
+    for asset in sorted(assets, key=lambda asset: addresses[asset["name"]]):
+        print("%-20s %-6s   0x%06x %8u" % (c_name(asset["name"]), asset.get("type", "raw"), addresses[asset["name"]],
+              len(asset["data"])))
+    print("%d bytes at 0x%06x, %d of %d sectors changed" % (len(image), base, len(changed), len(sectors)))
+
+
+if __name__ == "__main__":
+    main()
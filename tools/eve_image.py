@@ -0,0 +1,447 @@
+#!/usr/bin/env python3
+# eve_image.py - converts PNG and JPEG images into data for EVE and picks the cheapest format that looks good enough.
+#
+# usage: python3 tools/eve_image.py -o tft_images.c --header tft_images.h name=file.png[:FORMAT] [name=file.jpg ...]
+#
+# PNG files are converted to one of the bitmap formats of EVE, --format sets the format for all images,
+# name=file.png:RGB565 for a single image.
+# With "auto" all formats that can show the image are tried, from the smallest in RAM_G to the largest,
+# and the first one with a PSNR of at least --psnr dB is used, the error is measured on the colors
+# multiplied with alpha and on alpha itself.
+# The L formats are only tried for grey images, these are drawn with COLOR_RGB as the color and the level as alpha.
+# The pixel data is compressed with zlib for CMD_INFLATE, the level and the window that result in the fewest bytes
+# are used, if compressing does not save anything the data is left as it is for CMD_MEMWRITE.
+# PALETTED8 has to be drawn in four passes with COLOR_MASK, one for each channel, see the programming guide.
+# JPEG files are kept as they are for CMD_LOADIMAGE which decodes these to RGB565, progressive JPEG is not supported by EVE.
+# --gen 3 allows L2 which is only supported by BT81x.
+#
+# The header has the size, the stride and the format of every image, a NAME_IMAGE(address) initializer for
+# EVE_bitmap_image from EVE_bitmap.h and the declarations of the arrays in the .c file.
+# A report with the bytes in RAM_G and the bytes to upload for every image is printed.
+#
+# Only the Python standard library is used.
+
+import argparse
+import math
+import os
+import re
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# name: (EVE constant, bits per pixel, palette bytes per entry, lowest EVE generation)
+FORMATS = {
+    "L1": ("EVE_L1", 1, 0, 2),
+    "L2": ("EVE_L2", 2, 0, 3),
+    "L4": ("EVE_L4", 4, 0, 2),
+    "L8": ("EVE_L8", 8, 0, 2),
+    "ARGB1555": ("EVE_ARGB1555", 16, 0, 2),
+    "ARGB4": ("EVE_ARGB4", 16, 0, 2),
+    "RGB565": ("EVE_RGB565", 16, 0, 2),
+    "PALETTED565": ("EVE_PALETTED565", 8, 2, 2),
+    "PALETTED4444": ("EVE_PALETTED4444", 8, 2, 2),
+    "PALETTED8": ("EVE_PALETTED8", 8, 4, 2),
+}
+
+
+def c_name(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name)
+
+
+# ---- PNG ----
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa = abs(p - a)
+    pb = abs(p - b)
+    pc = abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+
+def png_unfilter(data, width, height, bpp, row_bytes):
+    rows = []
+    prior = bytearray(row_bytes)
+    pos = 0
+    for _ in range(height):
+        kind = data[pos]
+        row = bytearray(data[pos + 1:pos + 1 + row_bytes])
+        pos += 1 + row_bytes
+        for i in range(row_bytes):
+            left = row[i - bpp] if i >= bpp else 0
+            up = prior[i]
+            if kind == 1:
+                row[i] = (row[i] + left) & 255
+            elif kind == 2:
+                row[i] = (row[i] + up) & 255
+            elif kind == 3:
+                row[i] = (row[i] + ((left + up) >> 1)) & 255
+            elif kind == 4:
+                row[i] = (row[i] + paeth(left, up, prior[i - bpp] if i >= bpp else 0)) & 255
+            elif kind != 0:
+                raise ValueError("unknown PNG filter %d" % kind)
+        rows.append(row)
+        prior = row
+    return rows
+
+
+def read_png(path):
+    """returns width, height and a list of (r, g, b, a) tuples"""
+    with open(path, "rb") as file:
+        data = file.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError("not a PNG file")
+
+    pos = len(PNG_SIGNATURE)
+    idat = bytearray()
+    palette = []
+    transparency = b""
+    header = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            transparency = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    width, height, depth, color, _, _, interlace = header
+    if interlace:
+        raise ValueError("interlaced PNG is not supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits = depth * channels
+    rows = png_unfilter(zlib.decompress(bytes(idat)), width, height, max(1, bits // 8), (width * bits + 7) // 8)
+
+    pixels = []
+    maximum = (1 << depth) - 1
+    for row in rows:
+        if depth == 16:
+            samples = [row[i] for i in range(0, len(row), 2)]
+            maximum = 255
+        elif depth == 8:
+            samples = list(row)
+        else:
+            samples = []
+            for byte in row:
+                for shift in range(8 - depth, -1, -depth):
+                    samples.append((byte >> shift) & maximum)
+        for x in range(width):
+            sample = samples[x * channels:(x + 1) * channels]
+            if color == 3:
+                index = sample[0]
+                alpha = transparency[index] if index < len(transparency) else 255
+                pixels.append(palette[index] + (alpha,))
+                continue
+            sample = [(value * 255 + maximum // 2) // maximum for value in sample]
+            if color == 0:
+                alpha = 255
+                if len(transparency) == 2 and sample[0] == (struct.unpack(">H", transparency)[0] * 255 + maximum // 2) // maximum:
+                    alpha = 0
+                pixels.append((sample[0], sample[0], sample[0], alpha))
+            elif color == 4:
+                pixels.append((sample[0], sample[0], sample[0], sample[1]))
+            elif color == 2:
+                pixels.append((sample[0], sample[1], sample[2], 255))
+            else:
+                pixels.append(tuple(sample))
+    return width, height, pixels
+
+
+# ---- JPEG ----
+
+def read_jpeg(path):
+    """returns width, height and the file"""
+    with open(path, "rb") as file:
+        data = file.read()
+    if not data.startswith(b"\xff\xd8"):
+        raise ValueError("not a JPEG file")
+    pos = 2
+    while pos + 4 <= len(data):
+        if data[pos] != 0xFF:
+            raise ValueError("broken JPEG marker")
+        marker = data[pos + 1]
+        length = struct.unpack(">H", data[pos + 2:pos + 4])[0]
+        if marker in (0xC2, 0xC6, 0xCA, 0xCE):
+            raise ValueError("progressive JPEG can not be decoded by EVE")
+        if 0xC0 <= marker <= 0xCF and marker not in (0xC4, 0xC8, 0xCC):
+            height, width = struct.unpack(">HH", data[pos + 5:pos + 9])
+            return width, height, data
+        pos += 2 + length
+    raise ValueError("no frame header found")
+
+
+# ---- conversion ----
+
+def scale(value, bits):
+    return (value * ((1 << bits) - 1) + 127) // 255
+
+
+def expand(value, bits):
+    maximum = (1 << bits) - 1
+    return (value * 255 + maximum // 2) // maximum
+
+
+def median_cut(pixels, count):
+    """returns a palette of up to count RGBA colors"""
+    histogram = {}
+    for pixel in pixels:
+        histogram[pixel] = histogram.get(pixel, 0) + 1
+    if len(histogram) <= count:
+        return list(histogram)
+
+    boxes = [list(histogram.items())]
+    while len(boxes) < count:
+        boxes.sort(key=lambda box: sum(entry[1] for entry in box) * (len(box) > 1), reverse=True)
+        box = boxes.pop(0)
+        if len(box) < 2:
+            boxes.append(box)
+            break
+        ranges = [max(entry[0][c] for entry in box) - min(entry[0][c] for entry in box) for c in range(4)]
+        channel = ranges.index(max(ranges))
+        box.sort(key=lambda entry: entry[0][channel])
+        total = sum(entry[1] for entry in box)
+        running = 0
+        for split, entry in enumerate(box):
+            running += entry[1]
+            if running * 2 >= total:
+                break
+        split = min(max(split + 1, 1), len(box) - 1)
+        boxes.append(box[:split])
+        boxes.append(box[split:])
+
+    palette = []
+    for box in boxes:
+        total = sum(entry[1] for entry in box)
+        palette.append(tuple((sum(entry[0][c] * entry[1] for entry in box) + total // 2) // total for c in range(4)))
+    return palette
+
+
+def nearest(palette, pixel, cache):
+    if pixel not in cache:
+        cache[pixel] = min(range(len(palette)), key=lambda i: sum((palette[i][c] - pixel[c]) ** 2 for c in range(4)))
+    return cache[pixel]
+
+
+def encode(name, width, pixels):
+    """returns the bitmap, the palette, the stride and the pixels as EVE shows them"""
+    bits = FORMATS[name][1]
+    stride = (width * bits + 7) // 8
+    bitmap = bytearray()
+    palette = bytearray()
+    shown = []
+
+    if name.startswith("L"):
+        for start in range(0, len(pixels), width):
+            line = [scale(pixel[0], bits) for pixel in pixels[start:start + width]]
+            shown += [(expand(level, bits),) * 3 + (255,) for level in line]
+            packed = bytearray(stride)
+            for x, level in enumerate(line):
+                packed[(x * bits) // 8] |= level << (8 - bits - (x * bits) % 8)
+            bitmap += packed
+        return bitmap, palette, stride, shown
+
+    if name.startswith("PALETTED"):
+        colors = median_cut(pixels, 256)
+        entries = []
+        for r, g, b, a in colors:
+            if name == "PALETTED565":
+                value = (scale(r, 5) << 11) | (scale(g, 6) << 5) | scale(b, 5)
+                palette += struct.pack("<H", value)
+                entries.append((expand(scale(r, 5), 5), expand(scale(g, 6), 6), expand(scale(b, 5), 5), 255))
+            elif name == "PALETTED4444":
+                palette += struct.pack("<H", (scale(a, 4) << 12) | (scale(r, 4) << 8) | (scale(g, 4) << 4) | scale(b, 4))
+                entries.append(tuple(expand(scale(v, 4), 4) for v in (r, g, b, a)))
+            else:
+                palette += bytes((b, g, r, a))
+                entries.append((r, g, b, a))
+        cache = {}
+        for pixel in pixels:
+            index = nearest(colors, pixel, cache)
+            bitmap.append(index)
+            shown.append(entries[index])
+        return bitmap, palette, stride, shown
+
+    for r, g, b, a in pixels:
+        if name == "RGB565":
+            value = (scale(r, 5) << 11) | (scale(g, 6) << 5) | scale(b, 5)
+            shown.append((expand(scale(r, 5), 5), expand(scale(g, 6), 6), expand(scale(b, 5), 5), 255))
+        elif name == "ARGB1555":
+            value = ((a >= 128) << 15) | (scale(r, 5) << 10) | (scale(g, 5) << 5) | scale(b, 5)
+            shown.append(tuple(expand(scale(v, 5), 5) for v in (r, g, b)) + ((255 if a >= 128 else 0),))
+        else:
+            value = (scale(a, 4) << 12) | (scale(r, 4) << 8) | (scale(g, 4) << 4) | scale(b, 4)
+            shown.append(tuple(expand(scale(v, 4), 4) for v in (r, g, b, a)))
+        bitmap += struct.pack("<H", value)
+    return bitmap, palette, stride, shown
+
+
+def psnr(source, shown):
+    error = 0
+    for (r, g, b, a), (r2, g2, b2, a2) in zip(source, shown):
+        error += ((r * a - r2 * a2) / 255) ** 2 + ((g * a - g2 * a2) / 255) ** 2 + ((b * a - b2 * a2) / 255) ** 2 + (a - a2) ** 2
+    error /= len(source) * 4
+    return 99.0 if error == 0 else min(99.0, 10 * math.log10(255 * 255 / error))
+
+
+def compress(data):
+    """returns the smallest zlib stream, the level and the window bits"""
+    best = (None, 0, 0)
+    for window in range(9, 16):
+        for level in (1, 6, 9):
+            engine = zlib.compressobj(level, zlib.DEFLATED, window)
+            stream = engine.compress(bytes(data)) + engine.flush()
+            if best[0] is None or len(stream) < len(best[0]):
+                best = (stream, level, window)
+    return best
+
+
+def candidates(pixels, gen):
+    """returns the formats that can show the image, the smallest first"""
+    grey = all(r == g == b for r, g, b, _ in pixels)
+    opaque = all(pixel[3] == 255 for pixel in pixels)
+    colors = min(len(set(pixels)), 256)
+    names = []
+    for name, info in FORMATS.items():
+        if info[3] > gen:
+            continue
+        if name.startswith("L") and not (grey and opaque):
+            continue
+        if name in ("RGB565", "PALETTED565") and not opaque:
+            continue
+        if name in ("ARGB1555", "ARGB4") and opaque:
+            continue
+        names.append(name)
+    order = list(FORMATS)
+    return sorted(names, key=lambda name: (FORMATS[name][1] * len(pixels) // 8 + colors * FORMATS[name][2], order.index(name)))
+
+
+def convert(path, wanted, threshold, gen):
+    if path.lower().endswith((".jpg", ".jpeg")):
+        width, height, data = read_jpeg(path)
+        return {"width": width, "height": height, "format": "RGB565", "stride": width * 2, "data": data,
+                "palette": b"", "ram": width * height * 2, "method": "CMD_LOADIMAGE", "psnr": None}
+
+    width, height, pixels = read_png(path)
+    names = candidates(pixels, gen) if wanted == "AUTO" else [wanted]
+    if wanted not in FORMATS and wanted != "AUTO":
+        raise ValueError("unknown format %s" % wanted)
+
+    for name in names:
+        bitmap, palette, stride, shown = encode(name, width, pixels)
+        quality = psnr(pixels, shown)
+        if quality >= threshold or name == names[-1]:
+            break
+
+    stream, level, window = compress(bitmap)
+    if len(stream) < len(bitmap):
+        data, method = stream, "CMD_INFLATE, level %d, window %d" % (level, 1 << window)
+    else:
+        data, method = bytes(bitmap), "CMD_MEMWRITE"
+    return {"width": width, "height": height, "format": name, "stride": stride, "data": data, "palette": palette,
+            "ram": len(bitmap), "method": method, "psnr": quality, "inflate": data is stream}
+
+
+def write_array(file, name, data):
+    file.write("const uint8_t %s[%u] PROGMEM =\n{\n" % (name, len(data)))
+    for start in range(0, len(data), 24):
+        file.write("\t" + ", ".join("0x%02x" % value for value in data[start:start + 24]) + ",\n")
+    file.write("};\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="convert images into bitmap data for EVE")
+    parser.add_argument("--format", default="auto", help="auto or one of: " + ", ".join(FORMATS))
+    parser.add_argument("--psnr", type=float, default=35.0, help="minimum quality in dB for --format auto")
+    parser.add_argument("--gen", type=int, default=2, help="EVE generation, 3 or 4 for BT81x")
+    parser.add_argument("-o", "--output", required=True, help=".c file with the data")
+    parser.add_argument("--header", required=True, help="header with the constants")
+    parser.add_argument("images", nargs="+", metavar="name=file[:FORMAT]")
+    args = parser.parse_args()
+
+    results = []
+    for image in args.images:
+        if "=" not in image:
+            sys.exit("%s: expected name=file" % image)
+        name, path = image.split("=", 1)
+        wanted = args.format
+        match = re.match(r"(.*):([A-Za-z0-9]+)$", path)
+        if match and match.group(2).upper() in FORMATS:
+            path, wanted = match.group(1), match.group(2)
+        try:
+            result = convert(path, wanted.upper(), args.psnr, args.gen)
+        except (OSError, ValueError, zlib.error) as error:
+            sys.exit("%s: %s" % (path, error))
+        result["name"] = c_name(name)
+        result["path"] = path
+        results.append(result)
+
+    if len(set(result["name"] for result in results)) != len(results):
+        sys.exit("the names have to be unique")
+
+    header = os.path.basename(args.header)
+    guard = c_name(header).upper() + "_"
+    sources = " ".join(os.path.basename(result["path"]) for result in results)
+
+    with open(args.output, "w") as file:
+        file.write("/* generated by tools/eve_image.py from: %s */\n\n" % sources)
+        file.write("#include \"%s\"\n\n" % header)
+        for result in results:
+            write_array(file, result["name"], result["data"])
+            if result["palette"]:
+                write_array(file, result["name"] + "_palette", result["palette"])
+
+    with open(args.header, "w") as file:
+        file.write("/* generated by tools/eve_image.py from: %s */\n\n" % sources)
+        file.write("#pragma once\n\n#ifndef %s\n#define %s\n\n" % (guard, guard))
+        file.write("#if defined (__AVR__)\n\t#include <avr/pgmspace.h>\n#else\n\t#include <stdint.h>\n")
+        file.write("\t#if !defined (PROGMEM)\n\t\t#define PROGMEM\n\t#endif\n#endif\n\n")
+        for result in results:
+            upper = result["name"].upper()
+            file.write("/* %s, %s */\n" % (os.path.basename(result["path"]), result["method"]))
+            file.write("#define %s_WIDTH %uU\n" % (upper, result["width"]))
+            file.write("#define %s_HEIGHT %uU\n" % (upper, result["height"]))
+            file.write("#define %s_FORMAT %s\n" % (upper, FORMATS[result["format"]][0]))
+            file.write("#define %s_STRIDE %uU\n" % (upper, result["stride"]))
+            file.write("#define %s_SIZE %uUL /* bytes in RAM_G */\n" % (upper, result["ram"]))
+            if result["palette"]:
+                file.write("#define %s_PALETTE_SIZE %uUL\n" % (upper, len(result["palette"])))
+            if result.get("inflate"):
+                file.write("#define %s_INFLATE 1\n" % upper)
+            if result["method"] == "CMD_LOADIMAGE":
+                file.write("#define %s_LOADIMAGE 1\n" % upper)
+            file.write("#define %s_IMAGE(address) {(address), %s_FORMAT, %s_WIDTH, %s_HEIGHT, %s_STRIDE, 0U}\n" %
+                       (upper, upper, upper, upper, upper))
+            file.write("extern const uint8_t %s[%u] PROGMEM;\n" % (result["name"], len(result["data"])))
+            if result["palette"]:
+                file.write("extern const uint8_t %s_palette[%u] PROGMEM;\n" % (result["name"], len(result["palette"])))
+            file.write("\n")
+        file.write("#endif /* %s */\n" % guard)
+
+    total_ram = 0
+    total_upload = 0
+    print("%-16s %-12s %9s %8s %8s %7s  %s" % ("name", "format", "size", "RAM_G", "upload", "PSNR", "method"))
+    for result in results:
+        ram = result["ram"] + len(result["palette"])
+        upload = len(result["data"]) + len(result["palette"])
+        quality = "-" if result["psnr"] is None else "%.1f" % result["psnr"]
+        print("%-16s %-12s %4ux%-4u %8u %8u %7s  %s" % (result["name"], result["format"], result["width"],
+              result["height"], ram, upload, quality, result["method"]))
+        total_ram += ram
+        total_upload += upload
+    print("%-16s %-12s %9s %8u %8u" % ("total", "", "", total_ram, total_upload))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+# flashdl.py - builds a binary with static display-list segments for the flash attached to BT81x
+# and a header with the ids and the table for EVE_flashdl_init(), see EVE_flashdl.h.
+#
+# usage: python3 tools/flashdl.py --base 0x100000 -o dl_library.bin --header dl_library.h name=file [name=file ...]
+#
+# A file with the extension .bin is taken as raw display-list words, little-endian, like a dump of RAM_DL
+# or of a segment from EVE_segment.c read with EVE_memRead32().
+# All other files are text with the words as numbers, decimal or hex with 0x, separated by white-space or commas,
+# comments start with # or //, so the inside of a C array can be used as it is.
+# Each segment starts on a 64 byte boundary as CMD_APPENDF and CMD_FLASHREAD require this.
+# --base is the address in the flash the binary is written to, it has to be a multiple of 64 and
+# should be 4096 or more as the first 4096 bytes of the flash are the blob for BT81x.
+
+import argparse
+import binascii
+import os
+import re
+import struct
+import sys
+
+ALIGN = 64
+RAM_DL_SIZE = 8192
+DL_DISPLAY = 0x00000000
+
+
+def read_words(path):
+    if path.lower().endswith(".bin"):
+        with open(path, "rb") as file:
+            data = file.read()
+        if len(data) % 4:
+            sys.exit("%s: the size is not a multiple of four bytes" % path)
+        return list(struct.unpack("<%dI" % (len(data) // 4), data))
+
+    words = []
+    with open(path, "r") as file:
+        for number, line in enumerate(file, 1):
+            line = re.split(r"#|//", line, maxsplit=1)[0]
+            for token in re.split(r"[\s,]+", line.strip()):
+                if not token:
+                    continue
+                token = re.sub(r"[uUlL]+$", "", token)
+                try:
+                    value = int(token, 0)
+                except ValueError:
+                    sys.exit("%s:%d: not a number: %s" % (path, number, token))
+                if value < 0 or value > 0xFFFFFFFF:
+                    sys.exit("%s:%d: not a 32 bit value: %s" % (path, number, token))
+                words.append(value)
+    return words
+
+
+def c_name(name):
+    return re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="build static display-list segments for CMD_APPENDF")
+    parser.add_argument("--base", type=lambda text: int(text, 0), default=0x1000, help="address of the binary in the flash")
+    parser.add_argument("--prefix", default="DL_LIB", help="prefix for the names in the header")
+    parser.add_argument("-o", "--output", required=True, help="binary for the flash")
+    parser.add_argument("--header", required=True, help="header with the ids and the table")
+    parser.add_argument("segments", nargs="+", metavar="name=file")
+    args = parser.parse_args()
+
+    if args.base % ALIGN:
+        sys.exit("--base has to be a multiple of %d" % ALIGN)
+
+    prefix = c_name(args.prefix)
+    image = bytearray()
+    entries = []
+
+    for segment in args.segments:
+        if "=" not in segment:
+            sys.exit("%s: expected name=file" % segment)
+        name, path = segment.split("=", 1)
+        words = read_words(path)
+        if not words:
+            sys.exit("%s: no display-list words" % path)
+        if len(words) * 4 > RAM_DL_SIZE:
+            sys.exit("%s: %d bytes do not fit into RAM_DL" % (path, len(words) * 4))
+        if words[-1] == DL_DISPLAY:
+            print("%s: warning, ends with DISPLAY, the frame would end there" % path, file=sys.stderr)
+
+        data = struct.pack("<%dI" % len(words), *words)
+        entries.append((c_name(name), args.base + len(image), len(data), binascii.crc32(data) & 0xFFFFFFFF))
+        image += data
+        image += b"\xff" * (-len(image) % ALIGN)
+
+    if len(set(entry[0] for entry in entries)) != len(entries):
+        sys.exit("the names have to be unique")
+
+    with open(args.output, "wb") as file:
+        file.write(image)
+
+    guard = c_name(os.path.basename(args.header)) + "_"
+    with open(args.header, "w") as file:
+        file.write("/* generated by tools/flashdl.py from: %s */\n" % " ".join(args.segments))
+        file.write("/* %s has to be written to the flash at 0x%06x */\n\n" % (os.path.basename(args.output), args.base))
+        file.write("#pragma once\n\n#ifndef %s\n#define %s\n\n#include \"EVE_flashdl.h\"\n\n" % (guard, guard))
+        file.write("#define %s_BASE 0x%06xUL\n" % (prefix, args.base))
+        file.write("#define %s_SIZE %uUL\n" % (prefix, len(image)))
+        file.write("#define %s_COUNT %uU\n\n" % (prefix, len(entries)))
+        for index, entry in enumerate(entries):
+            file.write("#define %s_%s %uU\n" % (prefix, entry[0], index))
+        file.write("\nstatic const EVE_flashdl_entry %s_TABLE[%s_COUNT] =\n{\n" % (prefix, prefix))
+        for entry in entries:
+            file.write("\t{0x%06xUL, %uUL, 0x%08xUL}, /* %s */\n" % (entry[1], entry[2], entry[3], entry[0]))
+        file.write("};\n\n#endif /* %s */\n" % guard)
+
+    print("%d segments, %d bytes at 0x%06x" % (len(entries), len(image), args.base))
+
+
+if __name__ == "__main__":
+    main()
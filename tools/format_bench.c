@@ -0,0 +1,115 @@
+/*
+format_bench.c - measures how long EVE_cmd_text_var_burst() and EVE_cmd_number_fixed_burst() take to format their
+text on the host for FT81x, compared to formatting the same text with snprintf() and sending it with EVE_cmd_text_burst().
+
+The formatting on the host is only used with EVE_GEN 2, so select a FT81x display in EVE_config.h, for example EVE_EVE2_43.
+This uses the Linux target with EVE_init_capture() so it runs on a PC without a display:
+gcc -O2 -std=c99 -I. tools/format_bench.c EVE_commands*.c EVE_target.c -lpthread -o format_bench
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+#include "EVE_commands.h"
+
+#if EVE_GEN > 2
+#error "format_bench needs a display with EVE_GEN 2 selected in EVE_config.h"
+#endif
+
+#define BENCH_TEXTS 20U
+#define BENCH_LOOPS 20000U
+
+
+static uint64_t bench_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec;
+}
+
+
+static void bench_print(const char *name, uint64_t start)
+{
+	double elapsed = (double) (bench_ns() - start);
+
+	printf("%-44s %6.0f ns per frame, %5.1f ns per text\n", name, elapsed / BENCH_LOOPS, elapsed / (BENCH_LOOPS * BENCH_TEXTS));
+}
+
+
+int main(void)
+{
+	char buffer[32];
+	uint64_t start;
+	uint32_t loop;
+	uint8_t index;
+	FILE *capture = fopen("/dev/null", "w");
+
+	if(capture == NULL)
+	{
+		return 1;
+	}
+	EVE_init_capture(capture);
+	EVE_init();
+
+	start = bench_ns();
+	for(loop = 0; loop < BENCH_LOOPS; loop++)
+	{
+		EVE_start_cmd_burst();
+		for(index = 0; index < BENCH_TEXTS; index++)
+		{
+			EVE_cmd_text_var_burst(10, 12 * index, 26, EVE_OPT_FORMAT, "speed: %5d rpm", 1, (int) (loop + index));
+		}
+		EVE_dma_buffer_index = 1; /* only the time to build the frame is of interest */
+		EVE_end_cmd_burst();
+	}
+	bench_print("EVE_cmd_text_var_burst(\"%5d\")", start);
+
+	start = bench_ns();
+	for(loop = 0; loop < BENCH_LOOPS; loop++)
+	{
+		EVE_start_cmd_burst();
+		for(index = 0; index < BENCH_TEXTS; index++)
+		{
+			snprintf(buffer, sizeof(buffer), "speed: %5d rpm", (int) (loop + index));
+			EVE_cmd_text_burst(10, 12 * index, 26, 0, buffer);
+		}
+		EVE_dma_buffer_index = 1;
+		EVE_end_cmd_burst();
+	}
+	bench_print("snprintf(\"%5d\") + EVE_cmd_text_burst()", start);
+
+	start = bench_ns();
+	for(loop = 0; loop < BENCH_LOOPS; loop++)
+	{
+		EVE_start_cmd_burst();
+		for(index = 0; index < BENCH_TEXTS; index++)
+		{
+			EVE_cmd_number_fixed_burst(10, 12 * index, 26, 0, (int32_t) (loop * 7U) - 50000L, 2);
+		}
+		EVE_dma_buffer_index = 1;
+		EVE_end_cmd_burst();
+	}
+	bench_print("EVE_cmd_number_fixed_burst(2 decimals)", start);
+
+	start = bench_ns();
+	for(loop = 0; loop < BENCH_LOOPS; loop++)
+	{
+		EVE_start_cmd_burst();
+		for(index = 0; index < BENCH_TEXTS; index++)
+		{
+			int32_t number = (int32_t) (loop * 7U) - 50000L;
+			int32_t magnitude = (number < 0) ? -number : number;
+
+			snprintf(buffer, sizeof(buffer), "%s%ld.%02ld", (number < 0) ? "-" : "", (long) (magnitude / 100), (long) (magnitude % 100));
+			EVE_cmd_text_burst(10, 12 * index, 26, 0, buffer);
+		}
+		EVE_dma_buffer_index = 1;
+		EVE_end_cmd_burst();
+	}
+	bench_print("snprintf(\"%ld.%02ld\") + EVE_cmd_text_burst()", start);
+
+	fclose(capture);
+	return 0;
+}
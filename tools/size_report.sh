@@ -0,0 +1,40 @@
+#!/bin/sh
+# size_report.sh - compile the EVE_commands_xxx.c files for a target and list the code-size per file
+# and per build option, this is meant to find out how much EVE_BURST_ONLY / EVE_NO_BURST save.
+#
+# usage: CC=arm-none-eabi-gcc SIZE=arm-none-eabi-size CFLAGS="-mcpu=cortex-m0plus -Os -DEVE_EVE3_43" tools/size_report.sh
+#
+# CC, SIZE and CFLAGS default to the host tools, these need to at least select a display with -DEVE_xxx
+# in case EVE_config.h does not have one selected already.
+# EVE_TARGET_H can point to a replacement for EVE_target.h in case the target is not detected by the
+# compiler defines alone, the file is copied into the build directory as EVE_target.h.
+
+CC=${CC:-gcc}
+SIZE=${SIZE:-size}
+CFLAGS=${CFLAGS:--Os}
+
+LIB=$(cd "$(dirname "$0")/.." && pwd)
+BUILD=$(mktemp -d)
+trap 'rm -rf "$BUILD"' EXIT
+
+cp "$LIB"/EVE*.h "$LIB"/EVE_commands*.c "$BUILD"/
+if [ -n "$EVE_TARGET_H" ]; then
+	cp "$EVE_TARGET_H" "$BUILD"/EVE_target.h
+fi
+
+printf "%-16s %-24s %8s %8s %8s\n" "option" "file" "text" "data" "bss"
+
+for option in "" "-DEVE_BURST_ONLY" "-DEVE_NO_BURST"; do
+	total=0
+	for src in EVE_commands.c EVE_commands_copro.c EVE_commands_dl.c EVE_commands_burst.c; do
+		obj="$BUILD/${src%.c}.o"
+		if ! $CC -std=c99 $CFLAGS $option -c "$BUILD/$src" -o "$obj"; then
+			echo "failed to compile $src with '$option'" >&2
+			exit 1
+		fi
+		set -- $($SIZE "$obj" | tail -n 1)
+		printf "%-16s %-24s %8s %8s %8s\n" "${option:-default}" "$src" "$1" "$2" "$3"
+		total=$((total + $1 + $2))
+	done
+	printf "%-16s %-24s %8s\n\n" "${option:-default}" "text+data total" "$total"
+done
@@ -0,0 +1,140 @@
+/*
+widget_bench.c - measures how long EVE_widget_render_burst() takes for a page of widgets
+depending on the number of widgets that changed, compared to building the same page with the EVE_cmd_xxx_burst() functions.
+
+This uses the Linux target with EVE_init_capture() so it runs on a PC without a display:
+gcc -O2 -std=c99 -I. tools/widget_bench.c EVE_commands*.c EVE_target.c EVE_widget.c -lpthread -o widget_bench
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+#include "EVE_widget.h"
+
+#define BENCH_WIDGETS 60U
+#define BENCH_LOOPS 20000U
+
+static uint8_t ids[BENCH_WIDGETS];
+static char labels[BENCH_WIDGETS][8];
+
+
+static uint64_t bench_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec;
+}
+
+
+static void page_immediate(uint16_t value)
+{
+	uint8_t index;
+
+	for(index = 0; index < BENCH_WIDGETS; index++)
+	{
+		EVE_cmd_dl_burst(TAG(index));
+		EVE_cmd_dl_burst(DL_COLOR_RGB | 0xffffffUL);
+		switch(index % 3U)
+		{
+			case 0:
+				EVE_cmd_dl_burst(CMD_FGCOLOR);
+				EVE_cmd_dl_burst(0x003870);
+				EVE_cmd_button_burst(10, 4 * index, 80, 30, 26, 0, labels[index]);
+				break;
+			case 1:
+				EVE_cmd_dl_burst(CMD_BGCOLOR);
+				EVE_cmd_dl_burst(0x202020);
+				EVE_cmd_progress_burst(100, 4 * index, 120, 12, 0, value, 1000);
+				break;
+			default:
+				EVE_cmd_text_burst(240, 4 * index, 26, 0, labels[index]);
+				break;
+		}
+	}
+}
+
+
+int main(void)
+{
+	static const uint8_t changed[] = {0, 1, 5, 15, 30, BENCH_WIDGETS};
+	EVE_widget_props props = {0};
+	EVE_widget_stats before;
+	EVE_widget_stats after;
+	uint64_t start;
+	uint32_t loop;
+	uint8_t page;
+	uint8_t index;
+	uint8_t step;
+	FILE *capture = fopen("/dev/null", "w");
+
+	if(capture == NULL)
+	{
+		return 1;
+	}
+	EVE_init_capture(capture);
+	EVE_init();
+
+	EVE_widget_init();
+	page = EVE_widget_add(EVE_WIDGET_NONE, EVE_WIDGET_GROUP, &props, 0);
+	for(index = 0; index < BENCH_WIDGETS; index++)
+	{
+		snprintf(labels[index], sizeof(labels[index]), "w%u", index);
+		props.tag = index;
+		props.color = 0xffffffUL;
+		props.y = 4 * index;
+		props.text = labels[index];
+		props.font = 26;
+		switch(index % 3U)
+		{
+			case 0:
+				props.x = 10; props.w = 80; props.h = 30; props.fgcolor = 0x003870;
+				ids[index] = EVE_widget_add(page, EVE_WIDGET_BUTTON, &props, 7);
+				break;
+			case 1:
+				props.x = 100; props.w = 120; props.h = 12; props.range = 1000; props.bgcolor = 0x202020;
+				ids[index] = EVE_widget_add(page, EVE_WIDGET_PROGRESS, &props, 0);
+				break;
+			default:
+				props.x = 240;
+				ids[index] = EVE_widget_add(page, EVE_WIDGET_TEXT, &props, 7);
+				break;
+		}
+	}
+
+	start = bench_ns();
+	for(loop = 0; loop < BENCH_LOOPS; loop++)
+	{
+		EVE_start_cmd_burst();
+		page_immediate((uint16_t) loop);
+		EVE_dma_buffer_index = 1; /* only the time to build the frame is of interest */
+		EVE_end_cmd_burst();
+	}
+	printf("immediate, %u widgets: %6.0f ns per frame\n", BENCH_WIDGETS, (double) (bench_ns() - start) / BENCH_LOOPS);
+
+	for(step = 0; step < sizeof(changed); step++)
+	{
+		EVE_widget_get_stats(&before);
+		start = bench_ns();
+		for(loop = 0; loop < BENCH_LOOPS; loop++)
+		{
+			for(index = 0; index < changed[step]; index++)
+			{
+				EVE_widget_invalidate(ids[index]);
+			}
+			EVE_start_cmd_burst();
+			EVE_widget_render_burst(page);
+			EVE_dma_buffer_index = 1; /* only the time to build the frame is of interest */
+			EVE_end_cmd_burst();
+		}
+		EVE_widget_get_stats(&after);
+		printf("retained, %2u of %u changed: %6.0f ns per frame, %5.1f words encoded, %5.1f words kept\n",
+			changed[step], BENCH_WIDGETS, (double) (bench_ns() - start) / BENCH_LOOPS,
+			(double) (after.words_encoded - before.words_encoded) / BENCH_LOOPS,
+			(double) (after.words_kept - before.words_kept) / BENCH_LOOPS);
+	}
+
+	fclose(capture);
+	return 0;
+}